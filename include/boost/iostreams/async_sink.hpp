@@ -0,0 +1,118 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class template async_sink, which writes to a Sink on a
+// background thread. Requires C++11 threading support.
+
+#ifndef BOOST_IOSTREAMS_ASYNC_SINK_HPP_INCLUDED
+#define BOOST_IOSTREAMS_ASYNC_SINK_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>                      // BOOST_DEDUCED_TYPENAME.
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/detail/call_traits.hpp>
+#include <boost/iostreams/detail/ios.hpp>        // openmode, streamsize.
+#include <boost/iostreams/detail/write_behind.hpp>
+#include <boost/iostreams/operations.hpp>
+#include <boost/iostreams/traits.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+//
+// Template name: async_sink.
+// Template parameters:
+//      Sink - A model of Sink.
+// Description: Sink which copies the characters written to it into a bounded
+//      ring allocated at construction and returns, blocking only while the
+//      ring is full. A background thread, started by the first call to
+//      write(), removes characters from the ring and writes them to the given
+//      Sink. Flushing and closing wait until the background thread has
+//      written all pending characters, after which the Sink is flushed or
+//      closed on the calling thread; an exception thrown on the background
+//      thread is rethrown by the next call to write(), flush() or close().
+//      While a non-blocking Sink accepts no characters, the background thread
+//      yields before retrying. Copies share their state.
+//
+template<typename Sink>
+class async_sink {
+private:
+    BOOST_STATIC_ASSERT((
+        is_convertible<
+            BOOST_DEDUCED_TYPENAME mode_of<Sink>::type,
+            output
+        >::value
+    ));
+    typedef typename detail::param_type<Sink>::type  param_type;
+public:
+    typedef typename char_type_of<Sink>::type        char_type;
+    struct category
+        : sink_tag,
+          closable_tag,
+          flushable_tag
+        { };
+    BOOST_STATIC_CONSTANT(std::streamsize, default_ring_size = 64 * 1024);
+    explicit async_sink( param_type snk,
+                         std::streamsize ring_size = default_ring_size )
+        : pimpl_(new impl(snk, ring_size))
+        { }
+
+    std::streamsize write(const char_type* s, std::streamsize n)
+    {
+        impl& i = *pimpl_;
+        if (!i.engine_.started())
+            i.engine_.start(writer(i));
+        i.engine_.write(s, n);
+        return n;
+    }
+
+    bool flush()
+    {
+        pimpl_->engine_.drain();
+        return iostreams::flush(pimpl_->sink_);
+    }
+
+    void close() { pimpl_->engine_.close(closer(*pimpl_)); }
+
+    Sink& sink() { return pimpl_->sink_; }
+private:
+    struct impl {
+        impl(param_type snk, std::streamsize ring_size)
+            : sink_(snk), engine_(ring_size)
+            { }
+        typename detail::value_type<Sink>::type  sink_;
+        detail::write_behind<char_type>          engine_;  // Destroyed first.
+    };
+
+    struct writer {
+        explicit writer(impl& i) : impl_(i) { }
+        std::streamsize operator()(const char_type* s, std::streamsize n) const
+        { return iostreams::write(impl_.sink_, s, n); }
+        impl& impl_;
+    };
+    struct closer {
+        explicit closer(impl& i) : impl_(i) { }
+        void operator()() const
+        { iostreams::close(impl_.sink_, BOOST_IOS::out); }
+        impl& impl_;
+    };
+
+    shared_ptr<impl> pimpl_;
+};
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
+
+#endif // #ifndef BOOST_IOSTREAMS_ASYNC_SINK_HPP_INCLUDED
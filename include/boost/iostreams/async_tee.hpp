@@ -0,0 +1,527 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class template basic_async_tee, a Sink which copies the
+// characters written to it to any number of Sinks, each written to by its own
+// worker thread. Requires C++11 threading support.
+
+#ifndef BOOST_IOSTREAMS_ASYNC_TEE_HPP_INCLUDED
+#define BOOST_IOSTREAMS_ASYNC_TEE_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>                      // BOOST_NO_CXX11_XXX.
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC) || \
+    defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE) || \
+    defined(BOOST_NO_CXX11_HDR_MUTEX) || \
+    defined(BOOST_NO_CXX11_HDR_THREAD)
+# error "Boost.Iostreams: threaded components require C++11 threading support"
+#endif
+
+#include <algorithm>                             // copy, min.
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>                               // size_t.
+#include <deque>
+#include <exception>                             // exception_ptr.
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/detail/call_traits.hpp>
+#include <boost/iostreams/detail/ios.hpp>        // streamsize.
+#include <boost/iostreams/detail/spool.hpp>      // spill_file.
+#include <boost/iostreams/operations.hpp>
+#include <boost/iostreams/positioning.hpp>       // stream_offset.
+#include <boost/iostreams/traits.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_same.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+// Determines what an async_tee does with characters destined for a branch
+// whose queue is full.
+enum async_tee_policy {
+    block_on_full,   // Wait for the branch to catch up.
+    drop_on_full,    // Discard the characters, adding them to dropped().
+    spill_on_full    // Store the characters in a temporary file.
+};
+
+//
+// Template name: basic_async_tee.
+// Template parameters:
+//      Ch - The character type.
+// Description: Sink which copies the characters written to it to any number
+//      of blocking Sinks, called branches, each written to by its own worker
+//      thread. Characters are collected into reference-counted chunks, each of
+//      which is queued for every branch without being copied; a chunk is
+//      reused once all branches have written it. Each branch's queue holds a
+//      bounded number of characters; a policy chosen when the branch is added
+//      determines whether writing to a full queue blocks, discards the chunk
+//      or appends it to a temporary file, from which the worker reads once its
+//      queue is empty. Flushing and closing wait until every branch has
+//      written all pending characters, after which the branches are flushed
+//      or closed on the calling thread; an exception thrown on a worker thread
+//      is rethrown by the next call to write(), flush() or close(). Copies
+//      share their state.
+//
+template<typename Ch>
+class basic_async_tee {
+public:
+    typedef Ch char_type;
+    struct category
+        : sink_tag,
+          closable_tag,
+          flushable_tag
+        { };
+    BOOST_STATIC_CONSTANT(std::streamsize, default_chunk_size = 16 * 1024);
+    BOOST_STATIC_CONSTANT(std::streamsize, default_queue_size = 1024 * 1024);
+    explicit basic_async_tee(std::streamsize chunk_size = default_chunk_size)
+        : pimpl_(new impl(chunk_size))
+        { }
+
+    // Adds a branch which writes to a copy of snk, or to snk itself if it is
+    // a standard stream or stream buffer.
+    template<typename Sink>
+    void add( const Sink& snk, async_tee_policy policy = block_on_full,
+              std::streamsize queue_size = default_queue_size )
+    { add_impl<Sink>(snk, policy, queue_size); }
+    template<typename Sink>
+    void add( Sink& snk, async_tee_policy policy = block_on_full,
+              std::streamsize queue_size = default_queue_size )
+    { add_impl<Sink>(snk, policy, queue_size); }
+
+    std::size_t size() const { return pimpl_->branches_.size(); }
+
+    // Returns the number of characters discarded by the i-th branch since
+    // the branch was last started.
+    std::streamsize dropped(std::size_t i) const
+    {
+        branch& b = *pimpl_->branches_[i];
+        std::lock_guard<std::mutex> lock(b.mutex_);
+        return b.dropped_;
+    }
+
+    std::streamsize write(const char_type* s, std::streamsize n)
+    {
+        impl& i = *pimpl_;
+        i.check();
+        if (!i.started_)
+            start();
+        std::streamsize result = 0;
+        while (result < n) {
+            if (!i.current_)
+                i.current_ = i.fresh_chunk();
+            chunk& c = *i.current_;
+            std::streamsize amt =
+                (std::min)(n - result, i.chunk_size_ - c.size_);
+            std::copy(s + result, s + result + amt, &c.data_[0] + c.size_);
+            c.size_ += amt;
+            result += amt;
+            if (c.size_ == i.chunk_size_)
+                publish();
+        }
+        return n;
+    }
+
+    bool flush()
+    {
+        impl& i = *pimpl_;
+        i.check();
+        publish();
+        drain();
+        bool result = true;
+        for (std::size_t z = 0, n = i.branches_.size(); z < n; ++z)
+            result = i.branches_[z]->flush() && result;
+        return result;
+    }
+
+    void close()
+    {
+        impl& i = *pimpl_;
+        std::exception_ptr error;
+        try {
+            i.check();
+            publish();
+            drain();
+        } catch (...) {
+            error = std::current_exception();
+        }
+        i.stop();
+        i.current_.reset();
+        for (std::size_t z = 0, n = i.branches_.size(); z < n; ++z) {
+            try {
+                i.branches_[z]->close();
+            } catch (...) {
+                if (!error)
+                    error = std::current_exception();
+            }
+        }
+        if (error)
+            std::rethrow_exception(error);
+    }
+private:
+    struct chunk {
+        explicit chunk(std::streamsize size)
+            : data_(static_cast<std::size_t>(size)), size_(0)
+            { }
+        std::vector<char_type>  data_;
+        std::streamsize         size_;
+    };
+    typedef shared_ptr<chunk> chunk_ptr;
+
+    // A queue of chunks, together with an optional spill file, drained by
+    // a worker thread.
+    struct branch {
+        branch( std::atomic<bool>& failed, async_tee_policy policy,
+                std::streamsize capacity, std::streamsize chunk_size )
+            : policy_(policy), capacity_(capacity), chunk_size_(chunk_size),
+              failed_(failed), queued_(0), spill_read_(0), spill_write_(0),
+              spill_end_(0), dropped_(0), busy_(false), stop_(false)
+            { }
+        virtual ~branch() { stop(); }
+        virtual void write(const char_type* s, std::streamsize n) = 0;
+        virtual bool flush() = 0;
+        virtual void close() = 0;
+
+        bool spilled() const { return spill_read_ != spill_end_; }
+        bool idle() const { return queue_.empty() && !spilled() && !busy_; }
+
+        void start()
+        {
+            error_ = std::exception_ptr();
+            dropped_ = 0;
+            stop_ = false;
+            worker_ = std::thread(&branch::run, this);
+        }
+
+        void stop()
+        {
+            if (!worker_.joinable())
+                return;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cond_.notify_all();
+            worker_.join();
+            queue_.clear();  // Left by a failed worker.
+            queued_ = 0;
+            spill_read_ = spill_write_ = spill_end_ = 0;
+        }
+
+        // Called by the writing thread.
+        void enqueue(const chunk_ptr& c)
+        {
+            std::streamsize n = c->size_;
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (error_)
+                return;
+            if (spilled() || (queued_ != 0 && queued_ + n > capacity_)) {
+                switch (policy_) {
+                case block_on_full:
+                    while ( !error_ && queued_ != 0 &&
+                            queued_ + n > capacity_ )
+                    {
+                        cond_.wait(lock);
+                    }
+                    if (error_)
+                        return;
+                    break;
+                case drop_on_full:
+                    dropped_ += n;
+                    return;
+                case spill_on_full:
+                    spill(c->data_, n, lock);
+                    return;
+                }
+            }
+            queue_.push_back(c);
+            queued_ += n;
+            lock.unlock();
+            cond_.notify_all();
+        }
+
+        // Waits until the worker has written all queued characters.
+        void drain()
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (!idle() && !error_)
+                cond_.wait(lock);
+        }
+
+        void run()
+        {
+            try {
+                for (;;) {
+                    chunk_ptr        c;
+                    std::streamsize  n = 0;
+                    stream_offset    off = 0;
+                    {
+                        std::unique_lock<std::mutex> lock(mutex_);
+                        while ( queue_.empty() &&
+                                spill_read_ == spill_write_ && !stop_ )
+                        {
+                            cond_.wait(lock);
+                        }
+                        if (!queue_.empty()) {
+                            c = queue_.front();
+                            queue_.pop_front();
+                            n = c->size_;
+                        } else if (spill_read_ != spill_write_) {
+                            off = spill_read_;
+                            n = static_cast<std::streamsize>(
+                                    (std::min)( spill_write_ - spill_read_,
+                                                static_cast<stream_offset>(
+                                                    chunk_size_ *
+                                                    sizeof(char_type)) ) /
+                                    sizeof(char_type)
+                                );
+                        } else {
+                            return;
+                        }
+                        busy_ = true;
+                    }
+                    if (!c)
+                        unspill(off, n);
+                    write(c ? &c->data_[0] : &buffer_[0], n);
+                    {
+                        std::lock_guard<std::mutex> lock(mutex_);
+                        if (c) {
+                            queued_ -= n;
+                        } else {
+                            spill_read_ += static_cast<stream_offset>(
+                                               n * sizeof(char_type));
+                            if (spill_read_ == spill_end_)
+                                spill_read_ = spill_write_ = spill_end_ = 0;
+                        }
+                        busy_ = false;
+                    }
+                    c.reset();
+                    cond_.notify_all();
+                }
+            } catch (...) {
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    error_ = std::current_exception();
+                    busy_ = false;
+                }
+                failed_.store(true, std::memory_order_release);
+                cond_.notify_all();
+            }
+        }
+
+        // Appends n characters to the spill file. Called by the writing
+        // thread with mutex_ held, which is released while the file is
+        // written.
+        void spill( const std::vector<char_type>& data, std::streamsize n,
+                    std::unique_lock<std::mutex>& lock )
+        {
+            stream_offset off = spill_end_;
+            std::size_t size =
+                static_cast<std::size_t>(n) * sizeof(char_type);
+            spill_end_ += static_cast<stream_offset>(size);
+            lock.unlock();
+            try {
+                std::lock_guard<std::mutex> file_lock(spill_mutex_);
+                if (!spill_.is_open())
+                    spill_.open();
+                spill_.seek(off);
+                spill_.write(reinterpret_cast<const char*>(&data[0]), size);
+            } catch (...) {
+
+                // The characters following the failed write can't be read.
+                {
+                    std::lock_guard<std::mutex> guard(mutex_);
+                    error_ = std::current_exception();
+                }
+                failed_.store(true, std::memory_order_release);
+                cond_.notify_all();
+                throw;
+            }
+            lock.lock();
+            spill_write_ = off + static_cast<stream_offset>(size);
+            lock.unlock();
+            cond_.notify_all();
+        }
+
+        // Reads n characters at the given offset from the spill file into
+        // buffer_. Called by the worker thread without mutex_ held.
+        void unspill(stream_offset off, std::streamsize n)
+        {
+            buffer_.resize(static_cast<std::size_t>(chunk_size_));
+            std::lock_guard<std::mutex> file_lock(spill_mutex_);
+            spill_.seek(off);
+            spill_.read( reinterpret_cast<char*>(&buffer_[0]),
+                         static_cast<std::size_t>(n) * sizeof(char_type) );
+        }
+
+        const async_tee_policy   policy_;
+        const std::streamsize    capacity_;
+        const std::streamsize    chunk_size_;
+        std::atomic<bool>&       failed_;
+        mutable std::mutex       mutex_;
+        std::condition_variable  cond_;
+        std::deque<chunk_ptr>    queue_;
+        std::streamsize          queued_;   // Characters queued or in progress.
+        detail::spill_file       spill_;
+        std::mutex               spill_mutex_;
+        stream_offset            spill_read_;   // Offsets in bytes.
+        stream_offset            spill_write_;  // End of written data.
+        stream_offset            spill_end_;    // End of space being written.
+        std::vector<char_type>   buffer_;   // Worker only.
+        std::streamsize          dropped_;
+        bool                     busy_;
+        bool                     stop_;
+        std::exception_ptr       error_;
+        std::thread              worker_;
+    };
+
+    template<typename Sink>
+    struct branch_impl : branch {
+        typedef typename detail::param_type<Sink>::type  param_type;
+        branch_impl( param_type snk, std::atomic<bool>& failed,
+                     async_tee_policy policy, std::streamsize capacity,
+                     std::streamsize chunk_size )
+            : branch(failed, policy, capacity, chunk_size), sink_(snk)
+            { }
+        ~branch_impl() { this->stop(); }
+        void write(const char_type* s, std::streamsize n)
+        {
+            std::streamsize result = 0;
+            while (result < n)
+                result += iostreams::write(sink_, s + result, n - result);
+        }
+        bool flush() { return iostreams::flush(sink_); }
+        void close() { iostreams::close(sink_, BOOST_IOS::out); }
+        typename detail::value_type<Sink>::type sink_;
+    };
+
+    struct impl {
+        explicit impl(std::streamsize chunk_size)
+            : chunk_size_(chunk_size > 0 ? chunk_size : 1),
+              started_(false), failed_(false)
+            { }
+        ~impl() { stop(); }
+
+        void check()
+        {
+            if (!failed_.load(std::memory_order_acquire))
+                return;
+            for (std::size_t z = 0, n = branches_.size(); z < n; ++z) {
+                branch& b = *branches_[z];
+                std::exception_ptr error;
+                {
+                    std::lock_guard<std::mutex> lock(b.mutex_);
+                    error = b.error_;
+                }
+                if (error)
+                    std::rethrow_exception(error);
+            }
+        }
+
+        // Returns a chunk which no branch is using.
+        chunk_ptr fresh_chunk()
+        {
+            for (std::size_t z = 0, n = chunks_.size(); z < n; ++z)
+                if (chunks_[z].use_count() == 1) {
+                    chunks_[z]->size_ = 0;
+                    return chunks_[z];
+                }
+            chunks_.push_back(chunk_ptr(new chunk(chunk_size_)));
+            return chunks_.back();
+        }
+
+        void stop()
+        {
+            for (std::size_t z = 0, n = branches_.size(); z < n; ++z)
+                branches_[z]->stop();
+            started_ = false;
+            failed_.store(false);
+        }
+
+        const std::streamsize               chunk_size_;
+        std::vector< shared_ptr<branch> >   branches_;
+        std::vector<chunk_ptr>              chunks_;
+        chunk_ptr                           current_;
+        bool                                started_;
+        std::atomic<bool>                   failed_;
+    };
+
+    template<typename Sink>
+    void add_impl( typename detail::param_type<Sink>::type snk,
+                   async_tee_policy policy, std::streamsize queue_size )
+    {
+        BOOST_STATIC_ASSERT((
+            is_same<
+                char_type,
+                BOOST_DEDUCED_TYPENAME char_type_of<Sink>::type
+            >::value
+        ));
+        BOOST_STATIC_ASSERT((
+            is_convertible<
+                BOOST_DEDUCED_TYPENAME mode_of<Sink>::type,
+                output
+            >::value
+        ));
+        impl& i = *pimpl_;
+        shared_ptr<branch> b(
+            new branch_impl<Sink>( snk, i.failed_, policy, queue_size,
+                                   i.chunk_size_ )
+        );
+        i.branches_.push_back(b);
+        if (i.started_)
+            b->start();
+    }
+
+    void start()
+    {
+        impl& i = *pimpl_;
+        for (std::size_t z = 0, n = i.branches_.size(); z < n; ++z)
+            i.branches_[z]->start();
+        i.started_ = true;
+    }
+
+    // Passes the current chunk to each branch.
+    void publish()
+    {
+        impl& i = *pimpl_;
+        if (!i.current_ || i.current_->size_ == 0)
+            return;
+        chunk_ptr c;
+        c.swap(i.current_);
+        for (std::size_t z = 0, n = i.branches_.size(); z < n; ++z)
+            i.branches_[z]->enqueue(c);
+    }
+
+    // Waits until every branch has written all published characters.
+    void drain()
+    {
+        impl& i = *pimpl_;
+        for (std::size_t z = 0, n = i.branches_.size(); z < n; ++z)
+            i.branches_[z]->drain();
+        i.check();
+    }
+
+    shared_ptr<impl> pimpl_;
+};
+
+typedef basic_async_tee<char>     async_tee;
+typedef basic_async_tee<wchar_t>  wasync_tee;
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
+
+#endif // #ifndef BOOST_IOSTREAMS_ASYNC_TEE_HPP_INCLUDED
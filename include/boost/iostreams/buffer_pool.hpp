@@ -0,0 +1,339 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class buffer_pool, which recycles the memory used for stream
+// buffers and chain links, and the class template pooled_allocator, which
+// allows streams, stream buffers and chains to draw from it.
+
+#ifndef BOOST_IOSTREAMS_BUFFER_POOL_HPP_INCLUDED
+#define BOOST_IOSTREAMS_BUFFER_POOL_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <cstddef>                       // ptrdiff_t, size_t.
+#include <new>                           // bad_alloc, operator new.
+#include <boost/config.hpp>              // BOOST_NO_CXX11_XXX.
+#include <boost/throw_exception.hpp>
+
+#if !defined(BOOST_NO_CXX11_HDR_MUTEX) && \
+    !defined(BOOST_NO_CXX11_THREAD_LOCAL) \
+    /**/
+# include <mutex>
+#else
+# define BOOST_IOSTREAMS_NO_BUFFER_POOL
+#endif
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+//
+// Class name: buffer_pool.
+// Description: Allocates blocks of memory from free lists segregated by size
+//      class, each twice the size of the last. Blocks are freed to a small
+//      cache belonging to the calling thread, which exchanges batches of
+//      blocks with free lists shared by all threads when it becomes full or
+//      empty, so that most allocations take no lock. The number of bytes held
+//      by the shared free lists may be limited by calling set_capacity(); the
+//      limit is unbounded by default. Requests larger than max_block_size are
+//      passed to operator new. Without C++11 threading support, all requests
+//      are passed to operator new.
+//
+class buffer_pool {
+public:
+    static const std::size_t min_block_size = 64;
+    static const std::size_t max_block_size = 1024 * 1024;
+    static void* allocate(std::size_t size);
+    static void deallocate(void* p, std::size_t size);
+    static void set_capacity(std::size_t bytes);
+    static std::size_t capacity();
+    static std::size_t size();
+    static void release();
+#ifndef BOOST_IOSTREAMS_NO_BUFFER_POOL
+private:
+    struct block { block* next; };
+    struct free_list {
+        free_list() : head(0), count(0) { }
+        void push(block* b) { b->next = head; head = b; ++count; }
+        block* pop() { block* b = head; head = b->next; --count; return b; }
+        block*       head;
+        std::size_t  count;
+    };
+    enum { class_count = 15 };  // min_block_size << 14 == max_block_size.
+    static const std::size_t thread_cache_bytes = 256 * 1024;
+    static const std::size_t max_thread_cache_count = 64;
+
+    // Free lists shared by all threads. Never destroyed, so that blocks may
+    // be freed during the destruction of static objects.
+    struct shared_state {
+        shared_state() : size(0), capacity(static_cast<std::size_t>(-1)) { }
+        std::mutex   mutex;
+        free_list    lists[class_count];
+        std::size_t  size, capacity;
+    };
+
+    // Free lists belonging to a single thread; returned to the shared lists
+    // when the thread exits.
+    struct thread_cache {
+        ~thread_cache();
+        free_list    lists[class_count];
+    };
+
+    static shared_state& shared()
+    {
+        static shared_state* state = new shared_state;
+        return *state;
+    }
+    static thread_cache* local();
+    static std::size_t size_class(std::size_t size)
+    {
+        std::size_t result = 0, block_size = min_block_size;
+        while (block_size < size) {
+            block_size <<= 1;
+            ++result;
+        }
+        return result;
+    }
+    static std::size_t block_size(std::size_t c) { return min_block_size << c; }
+    static std::size_t cache_limit(std::size_t c)
+    {
+        std::size_t limit = thread_cache_bytes / block_size(c);
+        return limit < 2 ?
+            2 :
+            limit > max_thread_cache_count ?
+                max_thread_cache_count :
+                limit;
+    }
+    static void give_back(free_list& list, std::size_t c, std::size_t count);
+#endif // #ifndef BOOST_IOSTREAMS_NO_BUFFER_POOL
+};
+
+//
+// Template name: pooled_allocator.
+// Template parameters:
+//      T - The value type.
+//      Pool - A class with static member functions allocate() and
+//          deallocate() having the signatures of those of buffer_pool.
+// Description: Stateless Allocator which obtains memory from Pool. Used as
+//      the allocator template argument of stream_buffer, stream, chain,
+//      filtering_streambuf or filtering_stream, it causes both the character
+//      buffers and the chain links to be recycled through Pool.
+//
+template<typename T, typename Pool = buffer_pool>
+class pooled_allocator {
+public:
+    typedef T                  value_type;
+    typedef T*                 pointer;
+    typedef const T*           const_pointer;
+    typedef T&                 reference;
+    typedef const T&           const_reference;
+    typedef std::size_t        size_type;
+    typedef std::ptrdiff_t     difference_type;
+    template<typename U>
+    struct rebind { typedef pooled_allocator<U, Pool> other; };
+    pooled_allocator() { }
+    template<typename U>
+    pooled_allocator(const pooled_allocator<U, Pool>&) { }
+    pointer address(reference x) const { return &x; }
+    const_pointer address(const_reference x) const { return &x; }
+    pointer allocate(size_type n, const void* = 0)
+    {
+        if (n > max_size())
+            boost::throw_exception(std::bad_alloc());
+        return static_cast<pointer>(Pool::allocate(n * sizeof(T)));
+    }
+    void deallocate(pointer p, size_type n)
+    { Pool::deallocate(p, n * sizeof(T)); }
+    size_type max_size() const
+    { return static_cast<size_type>(-1) / sizeof(T); }
+    void construct(pointer p, const T& val) { ::new (static_cast<void*>(p)) T(val); }
+    void destroy(pointer p) { p->~T(); }
+};
+
+template<typename T, typename U, typename Pool>
+bool operator==( const pooled_allocator<T, Pool>&,
+                 const pooled_allocator<U, Pool>& )
+{ return true; }
+
+template<typename T, typename U, typename Pool>
+bool operator!=( const pooled_allocator<T, Pool>&,
+                 const pooled_allocator<U, Pool>& )
+{ return false; }
+
+//------------------Implementation of buffer_pool-----------------------------//
+
+#ifdef BOOST_IOSTREAMS_NO_BUFFER_POOL
+
+inline void* buffer_pool::allocate(std::size_t size)
+{ return ::operator new(size); }
+
+inline void buffer_pool::deallocate(void* p, std::size_t)
+{ ::operator delete(p); }
+
+inline void buffer_pool::set_capacity(std::size_t) { }
+
+inline std::size_t buffer_pool::capacity() { return 0; }
+
+inline std::size_t buffer_pool::size() { return 0; }
+
+inline void buffer_pool::release() { }
+
+#else // #ifdef BOOST_IOSTREAMS_NO_BUFFER_POOL
+
+inline buffer_pool::thread_cache::~thread_cache()
+{
+    for (std::size_t c = 0; c < class_count; ++c)
+        give_back(lists[c], c, lists[c].count);
+}
+
+inline buffer_pool::thread_cache* buffer_pool::local()
+{
+    // The flag, which has a trivial destructor, remains usable after the
+    // cache has been destroyed
+    static thread_local bool destroyed = false;
+    struct holder {
+        ~holder() { destroyed = true; }
+        thread_cache cache;
+    };
+    if (destroyed)
+        return 0;
+    static thread_local holder h;
+    return &h.cache;
+}
+
+// Moves count blocks from the given list to the shared free lists, freeing
+// those which would exceed the capacity
+inline void buffer_pool::give_back
+    (free_list& list, std::size_t c, std::size_t count)
+{
+    free_list excess;
+    {
+        shared_state&                s = shared();
+        std::lock_guard<std::mutex>  lock(s.mutex);
+        for (; count > 0; --count) {
+            block* b = list.pop();
+            if (s.size + block_size(c) <= s.capacity) {
+                s.lists[c].push(b);
+                s.size += block_size(c);
+            } else {
+                excess.push(b);
+            }
+        }
+    }
+    while (excess.head)
+        ::operator delete(excess.pop());
+}
+
+inline void* buffer_pool::allocate(std::size_t size)
+{
+    if (size > max_block_size)
+        return ::operator new(size);
+    std::size_t    c = size_class(size);
+    thread_cache*  cache = local();
+    if (cache) {
+        free_list& list = cache->lists[c];
+        if (!list.head) {
+            // Take up to half a cache's worth of blocks from the shared list
+            shared_state&                s = shared();
+            std::lock_guard<std::mutex>  lock(s.mutex);
+            for ( std::size_t n = cache_limit(c) / 2;
+                  n > 0 && s.lists[c].head;
+                  --n )
+            {
+                list.push(s.lists[c].pop());
+                s.size -= block_size(c);
+            }
+        }
+        if (list.head)
+            return list.pop();
+    } else {
+        shared_state&                s = shared();
+        std::lock_guard<std::mutex>  lock(s.mutex);
+        if (s.lists[c].head) {
+            s.size -= block_size(c);
+            return s.lists[c].pop();
+        }
+    }
+    return ::operator new(block_size(c));
+}
+
+inline void buffer_pool::deallocate(void* p, std::size_t size)
+{
+    if (!p)
+        return;
+    if (size > max_block_size) {
+        ::operator delete(p);
+        return;
+    }
+    std::size_t    c = size_class(size);
+    block*         b = static_cast<block*>(p);
+    thread_cache*  cache = local();
+    if (cache) {
+        free_list& list = cache->lists[c];
+        list.push(b);
+        if (list.count > cache_limit(c))
+            give_back(list, c, list.count / 2);
+    } else {
+        free_list single;
+        single.push(b);
+        give_back(single, c, 1);
+    }
+}
+
+inline void buffer_pool::set_capacity(std::size_t bytes)
+{
+    free_list excess;
+    {
+        shared_state&                s = shared();
+        std::lock_guard<std::mutex>  lock(s.mutex);
+        s.capacity = bytes;
+        for (std::size_t c = class_count; c-- > 0 && s.size > s.capacity; ) {
+            while (s.lists[c].head && s.size > s.capacity) {
+                excess.push(s.lists[c].pop());
+                s.size -= block_size(c);
+            }
+        }
+    }
+    while (excess.head)
+        ::operator delete(excess.pop());
+}
+
+inline std::size_t buffer_pool::capacity()
+{
+    shared_state&                s = shared();
+    std::lock_guard<std::mutex>  lock(s.mutex);
+    return s.capacity;
+}
+
+inline std::size_t buffer_pool::size()
+{
+    shared_state&                s = shared();
+    std::lock_guard<std::mutex>  lock(s.mutex);
+    return s.size;
+}
+
+inline void buffer_pool::release()
+{
+    if (thread_cache* cache = local()) {
+        for (std::size_t c = 0; c < class_count; ++c)
+            while (cache->lists[c].head)
+                ::operator delete(cache->lists[c].pop());
+    }
+    std::size_t capacity = buffer_pool::capacity();
+    set_capacity(0);
+    set_capacity(capacity);
+}
+
+#endif // #ifdef BOOST_IOSTREAMS_NO_BUFFER_POOL
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>  // MSVC.
+
+#endif // #ifndef BOOST_IOSTREAMS_BUFFER_POOL_HPP_INCLUDED
@@ -60,6 +60,9 @@ struct flushable_tag : virtual any_tag { };
 struct localizable_tag : virtual any_tag { };
 struct optimally_buffered_tag : virtual any_tag { };
 struct direct_tag : virtual any_tag { };          // Devices.
+namespace detail {                                // Sinks; see
+struct growable_tag : virtual any_tag { };        // direct_streambuf.
+}
 struct multichar_tag : virtual any_tag { };       // Filters.
 
 struct source_tag : device_tag, input { };
@@ -32,11 +32,14 @@
 #include <boost/iostreams/positioning.hpp>
 #include <boost/iostreams/traits.hpp>           // is_filter.
 #include <boost/iostreams/stream_buffer.hpp>
+#include <boost/make_shared.hpp>                // allocate_shared.
+#include <boost/mpl/bool.hpp>
 #include <boost/next_prior.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/throw_exception.hpp>
 #include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_same.hpp>
 #include <boost/type.hpp>
 #include <boost/iostreams/detail/execute.hpp>
 
@@ -125,10 +128,22 @@ public:
     friend class chain_client<Self>;
 private:
     typedef linked_streambuf<Ch>                   streambuf_type;
-    typedef std::list<streambuf_type*>             list_type;
+#if defined(BOOST_NO_STD_ALLOCATOR)
+    typedef std::allocator<streambuf_type*>        link_allocator;
+#elif defined(BOOST_NO_CXX11_ALLOCATOR)
+    typedef typename 
+            Alloc::template rebind<streambuf_type*>::other 
+            link_allocator;
+#else
+    typedef typename
+            std::allocator_traits<Alloc>::template 
+            rebind_alloc<streambuf_type*> 
+            link_allocator;
+#endif
+    typedef std::list<streambuf_type*, link_allocator>  list_type;
     typedef chain_base<Self, Ch, Tr, Alloc, Mode>  my_type;
 protected:
-    chain_base() : pimpl_(new chain_impl) { }
+    chain_base() : pimpl_(boost::allocate_shared<chain_impl>(Alloc())) { }
     chain_base(const chain_base& rhs): pimpl_(rhs.pimpl_) { }
 public:
 
@@ -208,6 +223,17 @@ public:
     size_type size() const { return list().size(); }
     void reset();
 
+    // Closes this chain and prepares it to be used again, retaining its
+    // components and buffers. reopen() also replaces the final device,
+    // keeping the buffer of its link if the new device has the same type.
+    void rewind();
+    template<typename Device>
+    void reopen(const Device& dev)
+    {
+        typedef typename unwrap_ios<Device>::type component_type;
+        reopen(dev, mpl::bool_<is_same<component_type, Device>::value>());
+    }
+
     //----------Additional i/o functions--------------------------------------//
 
     // Returns true if this chain is non-empty and its final link
@@ -271,6 +297,39 @@ private:
         notify();
     }
 
+    template<typename Device>
+    void reopen(const Device& dev, mpl::true_)
+    {
+        typedef stream_buffer<
+                    Device,
+                    BOOST_IOSTREAMS_CHAR_TRAITS(char_type),
+                    Alloc, Mode
+                >                                         streambuf_t;
+        if ( is_complete() && 
+             BOOST_IOSTREAMS_COMPARE_TYPE_ID(
+                 list().back()->component_type(), 
+                 BOOST_CORE_TYPEID(Device)
+             ) )
+        {
+            pimpl_->rewind();
+            static_cast<streambuf_t*>(list().back())->replace_component(dev);
+            notify();
+        } else {
+            reopen(dev, mpl::false_());
+        }
+    }
+
+    template<typename Device>
+    void reopen(const Device& dev, mpl::false_)
+    {
+        if (is_complete()) {
+            pimpl_->close();
+            pop();
+        }
+        pimpl_->rewind();
+        push(dev);
+    }
+
     list_type& list() { return pimpl_->links_; }
     const list_type& list() const { return pimpl_->links_; }
     void register_client(client_type* client) { pimpl_->client_ = client; }
@@ -351,6 +410,29 @@ private:
                     );
                 }
             }
+        void rewind()
+            {
+                try {
+                    close();
+                } catch (...) {
+                    try { rewind_links(); } catch (...) { }
+                    throw;
+                }
+                rewind_links();
+            }
+        void rewind_links()
+            {
+                typedef typename list_type::iterator iterator;
+                for ( iterator first = links_.begin(),
+                               last = links_.end();
+                      first != last;
+                      ++first )
+                {
+                    (*first)->rewind();
+                }
+                if ((flags_ & f_complete) != 0)
+                    flags_ |= f_open;
+            }
         void reset()
             {
                 typedef typename list_type::iterator iterator;
@@ -486,6 +568,9 @@ public:
     bool empty() const { return chain_->empty(); }
     size_type size() const { return chain_->size(); }
     void reset() { chain_->reset(); }
+    void rewind() { chain_->rewind(); }
+    template<typename Device>
+    void reopen(const Device& dev) { chain_->reopen(dev); }
 
     // Returns a copy of the underlying chain.
     chain_type filters() { return *chain_; }
@@ -570,6 +655,13 @@ bool chain_base<Self, Ch, Tr, Alloc, Mode>::strict_sync()
     return result;
 }
 
+template<typename Self, typename Ch, typename Tr, typename Alloc, typename Mode>
+void chain_base<Self, Ch, Tr, Alloc, Mode>::rewind()
+{
+    pimpl_->rewind();
+    notify();
+}
+
 template<typename Self, typename Ch, typename Tr, typename Alloc, typename Mode>
 void chain_base<Self, Ch, Tr, Alloc, Mode>::pop()
 {
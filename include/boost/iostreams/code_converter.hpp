@@ -40,8 +40,11 @@
 #include <boost/iostreams/detail/ios.hpp> // failure, openmode, int types, streamsize.
 #include <boost/iostreams/detail/optional.hpp>
 #include <boost/iostreams/detail/select.hpp>
+#include <boost/iostreams/detail/utf8.hpp>
 #include <boost/iostreams/traits.hpp>
 #include <boost/iostreams/operations.hpp>
+#include <boost/iostreams/utf8_codecvt.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/shared_ptr.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/throw_exception.hpp>
@@ -124,6 +127,7 @@ private:
 template<typename Device, typename Codecvt, typename Alloc>
 struct code_converter_impl {
     typedef typename codecvt_extern<Codecvt>::type          extern_type;
+    typedef typename codecvt_intern<Codecvt>::type          intern_type;
     typedef typename category_of<Device>::type              device_category;
     typedef is_convertible<device_category, input>          can_read;
     typedef is_convertible<device_category, output>         can_write;
@@ -144,7 +148,7 @@ struct code_converter_impl {
     typedef is_convertible<device_category, two_sequence>   is_double;
     typedef conversion_buffer<Codecvt, Alloc>               buffer_type;
 
-    code_converter_impl() : cvt_(), flags_(0) { }
+    code_converter_impl() : cvt_(), flags_(0), pending_() { }
 
     ~code_converter_impl()
     { 
@@ -172,6 +176,7 @@ struct code_converter_impl {
         }
         dev_.reset(concept_adapter<device_type>(dev));
         flags_ = f_open;
+        pending_ = intern_type();
     }
 
     void close()
@@ -186,6 +191,7 @@ struct code_converter_impl {
     {
         if (which == BOOST_IOS::in && (flags_ & f_input_closed) == 0) {
             flags_ |= f_input_closed;
+            pending_ = intern_type();
             iostreams::close(dev(), BOOST_IOS::in);
         }
         if (which == BOOST_IOS::out && (flags_ & f_output_closed) == 0) {
@@ -217,6 +223,7 @@ struct code_converter_impl {
         is_double
     >                        buf_;
     int                      flags_;
+    intern_type              pending_;  // Low surrogate awaiting read().
 };
 
 } // End namespace detail.
@@ -251,6 +258,8 @@ private:
     typedef typename detail::codecvt_intern<Codecvt>::type          intern_type;
     typedef typename detail::codecvt_extern<Codecvt>::type          extern_type;
     typedef typename detail::codecvt_state<Codecvt>::type           state_type;
+    typedef detail::utf8_conversion<Codecvt>                        utf8_type;
+    typedef mpl::bool_<(utf8_type::bits != 0)>                      is_utf8;
 public:
     typedef intern_type                                             char_type;    
     struct category 
@@ -276,8 +285,10 @@ public:
 
         // Device interface.
 
-    std::streamsize read(char_type*, std::streamsize);
-    std::streamsize write(const char_type*, std::streamsize);
+    std::streamsize read(char_type* s, std::streamsize n)
+    { return read(s, n, is_utf8()); }
+    std::streamsize write(const char_type* s, std::streamsize n)
+    { return write(s, n, is_utf8()); }
     void imbue(const std::locale& loc) { impl().cvt_.imbue(loc); }
 
         // Direct device access.
@@ -291,6 +302,11 @@ private:
         impl().open(t BOOST_IOSTREAMS_CONVERTER_ARGS()); 
     }
 
+    std::streamsize read(char_type*, std::streamsize, mpl::false_);
+    std::streamsize read(char_type*, std::streamsize, mpl::true_);
+    std::streamsize write(const char_type*, std::streamsize, mpl::false_);
+    std::streamsize write(const char_type*, std::streamsize, mpl::true_);
+
     const codecvt_type& cvt() { return impl().cvt_.get(); }
     device_type& dev() { return impl().dev(); }
     buffer_type& in() { return impl().buf_.first(); }
@@ -304,7 +320,7 @@ private:
 // it is ignored.
 template<typename Device, typename Codevt, typename Alloc>
 std::streamsize code_converter<Device, Codevt, Alloc>::read
-    (char_type* s, std::streamsize n)
+    (char_type* s, std::streamsize n, mpl::false_)
 {
     const extern_type*   next;        // Next external char.
     intern_type*         nint;        // Next internal char.
@@ -358,7 +374,7 @@ std::streamsize code_converter<Device, Codevt, Alloc>::read
 
 template<typename Device, typename Codevt, typename Alloc>
 std::streamsize code_converter<Device, Codevt, Alloc>::write
-    (const char_type* s, std::streamsize n)
+    (const char_type* s, std::streamsize n, mpl::false_)
 {
     buffer_type&        buf = out();
     extern_type*        next;              // Next external char.
@@ -408,6 +424,125 @@ std::streamsize code_converter<Device, Codevt, Alloc>::write
     return total;
 }
 
+// Conversion between UTF-8 and UTF-16 or UTF-32, bypassing the facet. Unlike
+// the general case, a partial character at the end of the stream is
+// treated as ill-formed.
+template<typename Device, typename Codevt, typename Alloc>
+std::streamsize code_converter<Device, Codevt, Alloc>::read
+    (char_type* s, std::streamsize n, mpl::true_)
+{
+    char_type*    next = s;             // Next internal char.
+    char_type*    end = s + n;
+    int           status = iostreams::char_traits<char>::good();
+    bool          partial = false;
+    buffer_type&  buf = in();
+    impl_type&    i = impl();
+
+    // Deliver the second half of a surrogate pair split by the last call.
+    if (i.pending_ != char_type() && next != end) {
+        *next++ = i.pending_;
+        i.pending_ = char_type();
+    }
+
+    while (next != end) {
+
+        // Fill buffer.
+        if (buf.ptr() == buf.eptr() || partial) {
+            status = buf.fill(dev());
+            if (buf.ptr() == buf.eptr())
+                break;
+            partial = false;
+        }
+
+        // Convert.
+        const extern_type* first = buf.ptr();
+        detail::utf_status result =
+            detail::utf8_decode<utf8_type::bits>( first, buf.eptr(), next,
+                                                  end, utf8_type::replace );
+        buf.ptr() += first - buf.ptr();
+
+        switch (result) {
+        case detail::utf_ok:
+            break;
+        case detail::utf_short_input:
+            if (status != EOF) {
+                partial = true;
+                break;
+            }
+            if (!utf8_type::replace)
+                boost::throw_exception(code_conversion_error());
+            *next++ = static_cast<char_type>(0xFFFD);
+            buf.ptr() = buf.eptr();
+            break;
+        case detail::utf_short_output:
+            if (next == s) {
+                // A surrogate pair, with room for half.
+                char_type  pair[2];
+                char_type* last = pair;
+                first = buf.ptr();
+                detail::utf8_decode<utf8_type::bits>( first, buf.eptr(),
+                                                      last, pair + 2,
+                                                      utf8_type::replace );
+                buf.ptr() += first - buf.ptr();
+                *next++ = pair[0];
+                i.pending_ = pair[1];
+            }
+            return static_cast<std::streamsize>(next - s);
+        case detail::utf_invalid:
+        default:
+            boost::throw_exception(code_conversion_error());
+        }
+        if (status == EOF || status == WOULD_BLOCK)
+            break;
+    }
+
+    return next == s && status == EOF ? -1 :
+           static_cast<std::streamsize>(next - s);
+}
+
+template<typename Device, typename Codevt, typename Alloc>
+std::streamsize code_converter<Device, Codevt, Alloc>::write
+    (const char_type* s, std::streamsize n, mpl::true_)
+{
+    const char_type*  next = s;         // Next internal char.
+    const char_type*  end = s + n;
+    bool              partial = false;
+    buffer_type&      buf = out();
+
+    while (next != end) {
+
+        // Empty buffer.
+        if (buf.eptr() == buf.end() || partial) {
+            if (!buf.flush(dev()))
+                break;
+            partial = false;
+        }
+
+        // Convert.
+        extern_type* last = buf.eptr();
+        detail::utf_status result =
+            detail::utf8_encode<utf8_type::bits>( next, end, last, buf.end(),
+                                                  utf8_type::replace );
+        buf.eptr() = last;
+
+        switch (result) {
+        case detail::utf_ok:
+            break;
+        case detail::utf_short_output:
+            partial = true;
+            break;
+        case detail::utf_short_input:
+            // A high surrogate ends the input; it will be written with the
+            // next call.
+            return static_cast<std::streamsize>(next - s);
+        case detail::utf_invalid:
+        default:
+            boost::throw_exception(code_conversion_error());
+        }
+    }
+    return static_cast<std::streamsize>(next - s);
+}
+
 //----------------------------------------------------------------------------//
 
 } } // End namespaces iostreams, boost.
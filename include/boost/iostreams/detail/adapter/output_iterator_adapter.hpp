@@ -13,10 +13,18 @@
 #endif              
 
 #include <algorithm>                      // copy.
+#include <cstddef>                        // size_t.
+#include <cstring>                        // memcpy.
 #include <iosfwd>                         // streamsize.
+#include <iterator>                       // iterator_traits.
 #include <boost/iostreams/categories.hpp> // tags.
+#include <boost/iostreams/detail/is_contiguous_iterator.hpp>
+#include <boost/mpl/and.hpp>
+#include <boost/mpl/bool.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
 
 namespace boost { namespace iostreams { namespace detail {
 
@@ -29,10 +37,43 @@ public:
     explicit output_iterator_adapter(OutIt out) : out_(out) { }
     std::streamsize write(const char_type* s, std::streamsize n) 
     { 
-        std::copy(s, s + n, out_); 
+        typedef std::iterator_traits<OutIt>                 traits;
+        typedef typename remove_cv<
+                    typename traits::value_type
+                >::type                                      value_type;
+        typedef mpl::and_<
+                    is_contiguous_iterator<OutIt>,
+                    is_same<value_type, Ch>
+                >                                            is_bulk;
+        typedef is_convertible<
+                    typename traits::iterator_category,
+                    std::forward_iterator_tag
+                >                                            is_forward;
+        write(s, n, is_bulk(), is_forward());
         return n; 
     }
 private:
+    // Contiguous iterators
+    template<typename Forward>
+    void write(const char_type* s, std::streamsize n, mpl::true_, Forward)
+    {
+        if (n > 0) {
+            std::memcpy( contiguous_address(out_), s,
+                         static_cast<std::size_t>(n) * sizeof(Ch) );
+            out_ += n;
+        }
+    }
+
+    // Other forward iterators, which must be advanced past the characters
+    // written
+    void write(const char_type* s, std::streamsize n, mpl::false_, mpl::true_)
+    { out_ = std::copy(s, s + n, out_); }
+
+    // Output iterators, such as std::back_insert_iterator, which advance
+    // themselves on assignment and need not be assignable
+    void write(const char_type* s, std::streamsize n, mpl::false_, mpl::false_)
+    { std::copy(s, s + n, out_); }
+
     OutIt out_;
 };
 
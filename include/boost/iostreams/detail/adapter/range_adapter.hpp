@@ -15,15 +15,24 @@
 #include <algorithm>                             // min.
 #include <boost/assert.hpp>
 #include <cstddef>                               // ptrdiff_t.
+#include <cstring>                               // memcpy.
 #include <iosfwd>                                // streamsize, streamoff.
 #include <iterator>                              // iterator_traits.
+#include <utility>                               // pair.
 #include <boost/iostreams/categories.hpp>
 #include <boost/iostreams/detail/error.hpp>
+#include <boost/iostreams/detail/is_contiguous_iterator.hpp>
 #include <boost/iostreams/positioning.hpp>
+#include <boost/mpl/and.hpp>
 #include <boost/mpl/if.hpp>
+#include <boost/mpl/not.hpp>
+#include <boost/mpl/or.hpp>
 #include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_const.hpp>
 #include <boost/type_traits/is_convertible.hpp>
+#include <boost/type_traits/remove_reference.hpp>
 #include <boost/core/enable_if.hpp>
+#include <boost/static_assert.hpp>
 
 // Must come last.
 #include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
@@ -33,9 +42,48 @@ namespace boost { namespace iostreams { namespace detail {
 // Used for simulated tag dispatch.
 template<typename Traversal> struct range_adapter_impl;
 
+// Tag for iterators satisfying is_contiguous_iterator.
+struct contiguous_iterator_tag : std::random_access_iterator_tag { };
+
+// Indicates whether a range_adapter with the given mode and iterator type can
+// model Direct: the iterator must be contiguous, the mode must have a single
+// sequence with a single head, as with array_adapter, and the elements must
+// be mutable if the mode is an output mode.
+template<typename Mode, typename Iter>
+struct is_direct_range
+    : mpl::and_<
+          is_contiguous_iterator<Iter>,
+          mpl::or_<
+              mpl::not_< is_convertible<Mode, input> >,
+              mpl::not_< is_convertible<Mode, output> >,
+              is_convertible<Mode, detail::one_head>
+          >,
+          mpl::or_<
+              mpl::not_< is_convertible<Mode, output> >,
+              mpl::not_<
+                  is_const<
+                      typename remove_reference<
+                          typename std::iterator_traits<Iter>::reference
+                      >::type
+                  >
+              >
+          >
+      >
+    { };
+
+template<typename Mode, bool Direct>
+struct range_adapter_category : Mode, device_tag { };
+
+template<typename Mode>
+struct range_adapter_category<Mode, true> : Mode, device_tag, direct_tag { };
+
 //
 // Template name: range_adapter
-// Description: Device based on an instance of boost::iterator_range.
+// Description: Device based on an instance of boost::iterator_range. If the
+//     range's iterators are contiguous, characters are transferred with
+//     memcpy and, if is_direct_range holds, the device models Direct, so
+//     that streams and copy() access the range without an intermediate
+//     buffer.
 // Template parameters:
 //     Mode - A mode tag.
 //     Range - An instance of iterator_range.
@@ -48,15 +96,24 @@ private:
     typedef typename iter_traits::iterator_category   iter_cat;
 public:
     typedef typename Range::value_type                char_type;
-    struct category : Mode, device_tag { };
+    typedef std::pair<char_type*, char_type*>         pair_type;
+    typedef range_adapter_category<
+                Mode,
+                is_direct_range<Mode, iterator>::value
+            >                                         category;
     typedef typename
             mpl::if_<
-                is_convertible<
-                    iter_cat,
-                    std::random_access_iterator_tag
-                >,
-                std::random_access_iterator_tag,
-                std::forward_iterator_tag
+                is_contiguous_iterator<iterator>,
+                contiguous_iterator_tag,
+                typename
+                mpl::if_<
+                    is_convertible<
+                        iter_cat,
+                        std::random_access_iterator_tag
+                    >,
+                    std::random_access_iterator_tag,
+                    std::forward_iterator_tag
+                >::type
             >::type                                   tag;
     typedef range_adapter_impl<tag>                   impl;
 
@@ -65,6 +122,8 @@ public:
     std::streamsize read(char_type* s, std::streamsize n);
     std::streamsize write(const char_type* s, std::streamsize n);
     std::streampos seek(stream_offset off, BOOST_IOS::seekdir way);
+    pair_type input_sequence();
+    pair_type output_sequence();
 private:
     iterator first_, cur_, last_;
 };
@@ -98,6 +157,26 @@ std::streampos range_adapter<Mode, Range>::seek
     return offset_to_position(cur_ - first_);
 }
 
+template<typename Mode, typename Range>
+typename range_adapter<Mode, Range>::pair_type
+range_adapter<Mode, Range>::input_sequence()
+{
+    BOOST_STATIC_ASSERT((is_direct_range<Mode, iterator>::value));
+
+    // An empty range is represented by a valid, empty sequence, since
+    // direct_streambuf treats null pointers as the absence of a sequence.
+    static char_type empty;
+    if (first_ == last_)
+        return pair_type(&empty, &empty);
+    char_type* p = const_cast<char_type*>(contiguous_address(first_));
+    return pair_type(p, p + (last_ - first_));
+}
+
+template<typename Mode, typename Range>
+inline typename range_adapter<Mode, Range>::pair_type
+range_adapter<Mode, Range>::output_sequence()
+{ return input_sequence(); }
+
 //------------------Implementation of range_adapter_impl----------------------//
 
 template<>
@@ -180,6 +259,41 @@ struct range_adapter_impl<std::random_access_iterator_tag> {
     }
 };
 
+template<>
+struct range_adapter_impl<contiguous_iterator_tag>
+    : range_adapter_impl<std::random_access_iterator_tag>
+{
+    template<typename Iter, typename Ch>
+    static std::streamsize read
+        (Iter& cur, Iter& last, Ch* s, std::streamsize n)
+    {
+        std::streamsize result =
+            (std::min)(static_cast<std::streamsize>(last - cur), n);
+        if (result) {
+            std::memcpy( s, contiguous_address(cur),
+                         static_cast<std::size_t>(result) * sizeof(Ch) );
+            cur += result;
+        }
+        return result != 0 ? result : -1;
+    }
+
+    template<typename Iter, typename Ch>
+    static std::streamsize write
+        (Iter& cur, Iter& last, const Ch* s, std::streamsize n)
+    {
+        std::streamsize count =
+            (std::min)(static_cast<std::streamsize>(last - cur), n);
+        if (count) {
+            std::memcpy( contiguous_address(cur), s,
+                         static_cast<std::size_t>(count) * sizeof(Ch) );
+            cur += count;
+        }
+        if (count < n)
+            boost::throw_exception(write_area_exhausted());
+        return n;
+    }
+};
+
 } } } // End namespaces detail, iostreams, boost.
 
 #include <boost/iostreams/detail/config/enable_warnings.hpp>  // MSVC.
@@ -0,0 +1,167 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Contains the definition of the class adaptive_level, used by the
+// compressors to raise or lower their compression level according to the
+// speed at which the downstream sink accepts data, in the manner of
+// zstd --adapt.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_ADAPTIVE_LEVEL_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_ADAPTIVE_LEVEL_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>                // BOOST_NO_CXX11_HDR_CHRONO.
+#include <boost/cstdint.hpp>               // intmax_t.
+#include <boost/iostreams/detail/ios.hpp>  // streamsize.
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+# include <chrono>
+#endif
+
+namespace boost { namespace iostreams { namespace detail {
+
+//
+// Class name: adaptive_level.
+// Description: Measures the time a compressor spends inside its filter
+//      function and the time its output buffer waits to be accepted by the
+//      downstream sink. Once per block of input, proposes a higher level if
+//      the sink is the bottleneck and a lower one if the compressor is.
+//      Without a monotonic clock, the level never changes.
+//
+class adaptive_level {
+public:
+    typedef boost::intmax_t (*clock_type)();
+    adaptive_level()
+        : enabled_(false), level_(0), target_(0), min_(0), max_(0),
+          block_size_(0), consumed_(0), filter_time_(0), sink_time_(0),
+          waiting_(false), stamp_(0)
+        { }
+    void open( bool enabled, int level, int min_level, int max_level,
+               std::streamsize block_size )
+    {
+    #ifndef BOOST_NO_CXX11_HDR_CHRONO
+        enabled_ = enabled && min_level <= max_level && block_size > 0;
+    #else
+        enabled_ = false;
+    #endif
+        min_ = min_level;
+        max_ = max_level;
+        block_size_ = block_size;
+        level_ = target_ = enabled_ ? clamp(level) : level;
+        close();
+    }
+    bool enabled() const { return enabled_; }
+    int level() const { return level_; }
+
+    // Returns true if a new level has been proposed but not yet applied.
+    bool pending() const { return target_ != level_; }
+    int target() const { return target_; }
+    void commit() { level_ = target_; }
+
+    // Called on entry to filter().
+    void begin()
+    {
+        if (enabled_)
+            begin(clock());
+    }
+
+    // Called on exit from filter(); output_full indicates that the
+    // filter returned because the output buffer was exhausted, so that
+    // the time until the next call is spent writing to the sink.
+    void end(std::streamsize consumed, bool output_full)
+    {
+        if (enabled_)
+            end(consumed, output_full, clock());
+    }
+
+    // As above, with the time given in nanoseconds.
+    void begin(boost::intmax_t now)
+    {
+        if (!enabled_)
+            return;
+        if (waiting_)
+            sink_time_ += now - stamp_;
+        stamp_ = now;
+    }
+    void end(std::streamsize consumed, bool output_full, boost::intmax_t now)
+    {
+        if (!enabled_)
+            return;
+        filter_time_ += now - stamp_;
+        stamp_ = now;
+        waiting_ = output_full;
+        consumed_ += consumed;
+        if (consumed_ >= block_size_)
+            adapt();
+    }
+
+    // Replaces the monotonic clock of all compressors with c, a function
+    // returning nanoseconds; intended for tests. A null pointer restores
+    // the monotonic clock.
+    static void set_clock(clock_type c) { clock_hook() = c; }
+
+    // Discards the measurements taken so far; the level is retained.
+    void close()
+    {
+        target_ = level_;
+        consumed_ = 0;
+        filter_time_ = sink_time_ = 0;
+        waiting_ = false;
+    }
+private:
+    int clamp(int level) const
+    { return level < min_ ? min_ : level > max_ ? max_ : level; }
+    void adapt()
+    {
+        if (!pending()) {
+            if (sink_time_ > 2 * filter_time_)
+                target_ = clamp(level_ + 1);
+            else if (filter_time_ > 2 * sink_time_)
+                target_ = clamp(level_ - 1);
+        }
+        // Older measurements decay rather than being discarded, since
+        // compressors emit their output in bursts.
+        consumed_ = 0;
+        filter_time_ /= 2;
+        sink_time_ /= 2;
+    }
+    static clock_type& clock_hook()
+    {
+        static clock_type c = 0;
+        return c;
+    }
+    static boost::intmax_t clock()
+    {
+        if (clock_type c = clock_hook())
+            return c();
+    #ifndef BOOST_NO_CXX11_HDR_CHRONO
+        return static_cast<boost::intmax_t>(
+                   std::chrono::duration_cast<std::chrono::nanoseconds>(
+                       std::chrono::steady_clock::now().time_since_epoch()
+                   ).count()
+               );
+    #else
+        return 0;
+    #endif
+    }
+    bool             enabled_;
+    int              level_;
+    int              target_;
+    int              min_;
+    int              max_;
+    std::streamsize  block_size_;
+    std::streamsize  consumed_;
+    boost::intmax_t  filter_time_;
+    boost::intmax_t  sink_time_;
+    bool             waiting_;
+    boost::intmax_t  stamp_;
+};
+
+} } } // End namespaces detail, iostreams, boost.
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_ADAPTIVE_LEVEL_HPP_INCLUDED
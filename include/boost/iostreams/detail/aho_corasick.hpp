@@ -0,0 +1,204 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Contains the definition of the class template aho_corasick, used by
+// basic_multi_replace_filter and basic_grep_filter to locate occurrences of
+// a set of literal strings.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_AHO_CORASICK_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_AHO_CORASICK_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <algorithm>                          // fill, lower_bound, sort.
+#include <cstddef>                            // size_t.
+#include <deque>
+#include <string>
+#include <utility>                            // pair.
+#include <vector>
+#include <boost/iostreams/detail/scan.hpp>    // byte_set.
+#include <boost/mpl/bool.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/make_unsigned.hpp>
+
+namespace boost { namespace iostreams { namespace detail {
+
+//
+// Template name: aho_corasick.
+// Template parameters:
+//      Ch - The character type.
+// Description: Deterministic Aho-Corasick automaton recognizing a set of
+//      literal patterns, each associated with a replacement. Characters are
+//      mapped to equivalence classes, so that the transition table has one
+//      column per distinct pattern character plus one for all others.
+//
+template<typename Ch>
+class aho_corasick {
+public:
+    typedef std::basic_string<Ch>  string_type;
+    aho_corasick()
+        : wide_offset_(0), classes_(1), max_length_(0), compiled_(false)
+    {
+        std::fill(narrow_, narrow_ + 256, static_cast<std::size_t>(0));
+    }
+
+    // Adds a pattern; a pattern added twice keeps the later replacement.
+    void add(const string_type& pattern, const string_type& replacement)
+    {
+        if (pattern.empty())
+            return;
+        for (std::size_t z = 0, len = patterns_.size(); z < len; ++z)
+            if (patterns_[z].first == pattern) {
+                patterns_[z].second = replacement;
+                return;
+            }
+        patterns_.push_back(std::make_pair(pattern, replacement));
+        compiled_ = false;
+    }
+    bool compiled() const { return compiled_; }
+    void compile();
+
+    // Returns the length of the longest pattern.
+    std::size_t max_length() const { return max_length_; }
+    int next(int state, Ch c) const
+    { return delta_[static_cast<std::size_t>(state) * classes_ + class_of(c)]; }
+    int depth(int state) const { return depth_[state]; }
+
+    // Returns the length of the longest pattern which is a suffix of the
+    // string recognized by the given state, or zero.
+    int match_length(int state) const { return match_length_[state]; }
+    const string_type& replacement(int state) const
+    { return patterns_[match_[state]].second; }
+
+    // Returns the first position in [first, last) at which a pattern
+    // may begin.
+    const Ch* skip(const Ch* first, const Ch* last) const
+    { return skip(first, last, is_same<Ch, char>()); }
+private:
+    typedef typename make_unsigned<Ch>::type  unsigned_type;
+    std::size_t class_of(Ch c) const
+    {
+        unsigned_type u = static_cast<unsigned_type>(c);
+        if (u < 256)
+            return narrow_[u];
+        typename std::vector<Ch>::const_iterator it =
+            std::lower_bound(wide_.begin(), wide_.end(), c);
+        return it != wide_.end() && *it == c ?
+            256 + (it - wide_.begin()) - wide_offset_ :
+            0;
+    }
+    const char* skip(const char* first, const char* last, mpl::true_) const
+    { return starts_.find(first, last); }
+    const Ch* skip(const Ch* first, const Ch* last, mpl::false_) const
+    {
+        while (first != last && delta_[class_of(*first)] == 0)
+            ++first;
+        return first;
+    }
+    std::vector< std::pair<string_type, string_type> >  patterns_;
+    std::size_t         narrow_[256];
+    std::vector<Ch>     wide_;
+    std::size_t         wide_offset_;
+    std::size_t         classes_;
+    std::vector<int>    delta_;
+    std::vector<int>    depth_;
+    std::vector<int>    match_length_;
+    std::vector<int>    match_;
+    byte_set            starts_;
+    std::size_t         max_length_;
+    bool                compiled_;
+};
+
+template<typename Ch>
+void aho_corasick<Ch>::compile()
+{
+    // Assign a class to each distinct pattern character.
+    std::fill(narrow_, narrow_ + 256, static_cast<std::size_t>(0));
+    wide_.clear();
+    starts_ = byte_set();
+    classes_ = 1;
+    max_length_ = 0;
+    for (std::size_t z = 0, len = patterns_.size(); z < len; ++z) {
+        const string_type& pat = patterns_[z].first;
+        max_length_ = (std::max)(max_length_, pat.size());
+        for (std::size_t y = 0; y < pat.size(); ++y) {
+            unsigned_type u = static_cast<unsigned_type>(pat[y]);
+            if (u < 256) {
+                if (narrow_[u] == 0)
+                    narrow_[u] = classes_++;
+            } else {
+                wide_.push_back(pat[y]);
+            }
+        }
+        if (static_cast<unsigned_type>(pat[0]) < 256)
+            starts_.insert(static_cast<unsigned char>(pat[0]));
+    }
+    std::sort(wide_.begin(), wide_.end());
+    wide_.erase(std::unique(wide_.begin(), wide_.end()), wide_.end());
+    wide_offset_ = 256 - classes_;
+    classes_ += wide_.size();
+
+    // Build the trie; -1 marks a missing transition.
+    std::vector<int> terminal(1, -1);
+    delta_.assign(classes_, -1);
+    depth_.assign(1, 0);
+    for (std::size_t z = 0, len = patterns_.size(); z < len; ++z) {
+        const string_type& pat = patterns_[z].first;
+        int s = 0;
+        for (std::size_t y = 0; y < pat.size(); ++y) {
+            std::size_t t = static_cast<std::size_t>(s) * classes_ +
+                            class_of(pat[y]);
+            if (delta_[t] == -1) {
+                delta_[t] = static_cast<int>(depth_.size());
+                depth_.push_back(depth_[s] + 1);
+                terminal.push_back(-1);
+                delta_.resize(delta_.size() + classes_, -1);
+            }
+            s = delta_[t];
+        }
+        terminal[s] = static_cast<int>(z);
+    }
+
+    // Compute failure links breadth first, completing the transition
+    // function and recording the longest match recognized by each state.
+    std::size_t states = depth_.size();
+    std::vector<int> fail(states, 0);
+    match_length_.assign(states, 0);
+    match_.assign(states, -1);
+    std::deque<int> queue;
+    queue.push_back(0);
+    while (!queue.empty()) {
+        int u = queue.front();
+        queue.pop_front();
+        for (std::size_t c = 0; c < classes_; ++c) {
+            std::size_t t = static_cast<std::size_t>(u) * classes_ + c;
+            int f = u == 0 ?
+                0 :
+                delta_[static_cast<std::size_t>(fail[u]) * classes_ + c];
+            int v = delta_[t];
+            if (v == -1) {
+                delta_[t] = f;
+                continue;
+            }
+            fail[v] = f;
+            if (terminal[v] != -1) {
+                match_length_[v] = depth_[v];
+                match_[v] = terminal[v];
+            } else {
+                match_length_[v] = match_length_[f];
+                match_[v] = match_[f];
+            }
+            queue.push_back(v);
+        }
+    }
+    compiled_ = true;
+}
+
+} } } // End namespaces detail, iostreams, boost.
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_AHO_CORASICK_HPP_INCLUDED
@@ -108,6 +108,12 @@ public:
     bool strict_sync() { return this->member.strict_sync(); }
     Device& operator*() { return *this->member; }
     Device* operator->() { return &*this->member; }
+    std::pair<const char_type*, const char_type*>
+    peek_window(std::streamsize n = 1) { return this->member.peek_window(n); }
+    void consume(std::streamsize n) { this->member.consume(n); }
+    std::pair<char_type*, char_type*> reserve(std::streamsize n = 1)
+    { return this->member.reserve(n); }
+    void commit(std::streamsize n) { this->member.commit(n); }
 private:
     template<typename U0>
     void open_impl(mpl::false_, const U0& u0)
@@ -118,6 +118,15 @@ public:
 #endif // !BOOST_WORKAROUND(BOOST_MSVC, <= 1300) //---------------------------//
     T& operator*() { return *this->component(); }
     T* operator->() { return this->component(); }
+
+    // Memory for stream buffers, such as the links of a chain, is obtained
+    // from Alloc.
+    static void* operator new(std::size_t size)
+    { return detail::allocated_storage<stream_buffer, Alloc>::allocate(size); }
+    static void operator delete(void* p, std::size_t size)
+    { detail::allocated_storage<stream_buffer, Alloc>::deallocate(p, size); }
+    static void* operator new(std::size_t, void* p) { return p; }
+    static void operator delete(void*, void*) { }
 private:
     template<typename U0>
     void open_impl(mpl::false_, const U0& u0)
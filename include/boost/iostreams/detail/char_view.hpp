@@ -0,0 +1,55 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Contains the definition of the class template basic_char_view, a
+// non-owning reference to a sequence of characters. Used in place of
+// boost::string_view, whose header introduces the namespace boost::io and so
+// conflicts with the common namespace alias io for boost::iostreams.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_CHAR_VIEW_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_CHAR_VIEW_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <cstddef>  // ptrdiff_t, size_t.
+#include <string>
+
+namespace boost { namespace iostreams { namespace detail {
+
+template<typename Ch>
+class basic_char_view {
+public:
+    typedef Ch              value_type;
+    typedef std::size_t     size_type;
+    typedef std::ptrdiff_t  difference_type;
+    typedef const Ch*       const_iterator;
+    typedef const Ch*       iterator;
+    typedef const Ch&       const_reference;
+    basic_char_view() : data_(0), size_(0) { }
+    basic_char_view(const Ch* data, size_type size) 
+        : data_(data), size_(size) 
+        { }
+    const Ch* data() const { return data_; }
+    size_type size() const { return size_; }
+    size_type length() const { return size_; }
+    bool empty() const { return size_ == 0; }
+    const_iterator begin() const { return data_; }
+    const_iterator end() const { return data_ + size_; }
+    const_reference operator[](size_type i) const { return data_[i]; }
+    const_reference front() const { return data_[0]; }
+    const_reference back() const { return data_[size_ - 1]; }
+    std::basic_string<Ch> str() const 
+    { return std::basic_string<Ch>(data_, size_); }
+private:
+    const Ch*  data_;
+    size_type  size_;
+};
+
+} } } // End namespaces detail, iostreams, boost.
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_CHAR_VIEW_HPP_INCLUDED
@@ -0,0 +1,37 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Detects the vector instruction sets available to the character scanning
+// routines in <boost/iostreams/detail/scan.hpp>. Define
+// BOOST_IOSTREAMS_NO_SIMD to fall back to portable code.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_CONFIG_SIMD_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_CONFIG_SIMD_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>
+
+#if !defined(BOOST_IOSTREAMS_NO_SIMD)
+# if defined(__SSE2__) || defined(_M_X64) || defined(_M_AMD64) || \
+     (defined(_M_IX86_FP) && _M_IX86_FP >= 2) \
+     /**/
+#  define BOOST_IOSTREAMS_HAS_SSE2
+# endif
+# if defined(__SSSE3__) || defined(__AVX__)
+#  define BOOST_IOSTREAMS_HAS_SSSE3
+# endif
+# if defined(__AVX2__)
+#  define BOOST_IOSTREAMS_HAS_AVX2
+# endif
+# if defined(__ARM_NEON) || defined(__ARM_NEON__) || defined(_M_ARM64)
+#  define BOOST_IOSTREAMS_HAS_NEON
+# endif
+#endif
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_CONFIG_SIMD_HPP_INCLUDED
@@ -0,0 +1,99 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the metafunction is_contiguous_iterator and the function
+// contiguous_address, used by range_adapter and output_iterator_adapter to
+// replace element-by-element copying with memcpy.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_IS_CONTIGUOUS_ITERATOR_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_IS_CONTIGUOUS_ITERATOR_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <iterator>                       // iterator_traits.
+#include <string>
+#include <vector>
+#include <boost/iostreams/detail/config/wide_streams.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/or.hpp>
+#include <boost/type_traits/is_pointer.hpp>
+#include <boost/type_traits/is_same.hpp>
+#include <boost/type_traits/remove_cv.hpp>
+
+namespace boost { namespace iostreams { namespace detail {
+
+template<typename Iter, typename Value>
+struct is_contiguous_iterator_impl
+    : mpl::or_<
+          is_same<Iter, typename std::vector<Value>::iterator>,
+          is_same<Iter, typename std::vector<Value>::const_iterator>
+      >
+    { };
+
+#define BOOST_IOSTREAMS_CONTIGUOUS_STRING_ITERATOR(ch) \
+    template<typename Iter> \
+    struct is_contiguous_iterator_impl<Iter, ch> \
+        : mpl::or_< \
+              is_same<Iter, std::vector<ch>::iterator>, \
+              is_same<Iter, std::vector<ch>::const_iterator>, \
+              is_same<Iter, std::basic_string<ch>::iterator>, \
+              is_same<Iter, std::basic_string<ch>::const_iterator> \
+          > \
+        { }; \
+    /**/
+BOOST_IOSTREAMS_CONTIGUOUS_STRING_ITERATOR(char)
+#ifndef BOOST_IOSTREAMS_NO_WIDE_STREAMS
+BOOST_IOSTREAMS_CONTIGUOUS_STRING_ITERATOR(wchar_t)
+#endif
+#undef BOOST_IOSTREAMS_CONTIGUOUS_STRING_ITERATOR
+
+// std::vector<bool>::iterator addresses bits, and output iterators such
+// as std::back_insert_iterator have no value type.
+template<typename Iter>
+struct is_contiguous_iterator_impl<Iter, bool> : mpl::false_ { };
+
+template<typename Iter>
+struct is_contiguous_iterator_impl<Iter, void> : mpl::false_ { };
+
+//
+// Template name: is_contiguous_iterator.
+// Description: Indicates whether Iter is known to address consecutive
+//      elements of an array, so that [first, first + n) may be accessed
+//      as [&*first, &*first + n). Recognizes pointers, the iterators of
+//      std::vector and std::basic_string and, where the standard library
+//      provides the concept, models of std::contiguous_iterator. Other
+//      iterators are treated as non-contiguous.
+//
+template<typename Iter>
+struct is_contiguous_iterator
+    : mpl::bool_<
+          #if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+              std::contiguous_iterator<Iter> ||
+          #endif
+          is_pointer<Iter>::value ||
+          is_contiguous_iterator_impl<
+              Iter,
+              typename remove_cv<
+                  typename std::iterator_traits<Iter>::value_type
+              >::type
+          >::value
+      >
+    { };
+
+// Returns the address of the element denoted by a contiguous iterator. The
+// iterator must be dereferenceable.
+template<typename Iter>
+inline typename std::iterator_traits<Iter>::pointer
+contiguous_address(Iter it) { return &*it; }
+
+template<typename T>
+inline T* contiguous_address(T* it) { return it; }
+
+} } } // End namespaces detail, iostreams, boost.
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_IS_CONTIGUOUS_ITERATOR_HPP_INCLUDED
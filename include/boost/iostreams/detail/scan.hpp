@@ -0,0 +1,376 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Contains routines for locating and counting characters in a buffer,
+// vectorized for narrow characters where the target supports it. See
+// <boost/iostreams/detail/config/simd.hpp>.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_SCAN_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_SCAN_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <algorithm>                            // count, find.
+#include <cstddef>                              // size_t.
+#include <cstring>                              // memchr, memset.
+#include <boost/config.hpp>                     // BOOST_STATIC_CONSTANT.
+#include <boost/cstdint.hpp>                    // uint64_t.
+#include <boost/iostreams/detail/config/simd.hpp>
+#if defined(BOOST_IOSTREAMS_HAS_AVX2)
+# include <immintrin.h>
+#endif
+#if defined(BOOST_IOSTREAMS_HAS_SSSE3)
+# include <tmmintrin.h>
+#endif
+#if defined(BOOST_IOSTREAMS_HAS_SSE2)
+# include <emmintrin.h>
+#elif defined(BOOST_IOSTREAMS_HAS_NEON)
+# include <arm_neon.h>
+#endif
+#if defined(BOOST_MSVC)
+# include <intrin.h>
+#endif
+
+namespace boost { namespace iostreams { namespace detail {
+
+// Returns the index of the least significant set bit of a non-zero value.
+inline unsigned int lowest_bit(boost::uint64_t n)
+{
+#if defined(BOOST_MSVC) && defined(_M_X64)
+    unsigned long result;
+    _BitScanForward64(&result, n);
+    return result;
+#elif defined(__GNUC__)
+    return static_cast<unsigned int>(__builtin_ctzll(n));
+#else
+    unsigned int result = 0;
+    while ((n & 1) == 0) {
+        n >>= 1;
+        ++result;
+    }
+    return result;
+#endif
+}
+
+// Returns the first position in [first, last) holding either a or b, or
+// last if there is none.
+inline const char* find_either( const char* first, const char* last,
+                                char a, char b )
+{
+#if defined(BOOST_IOSTREAMS_HAS_AVX2)
+    if (last - first >= 32) {
+        __m256i lhs = _mm256_set1_epi8(a);
+        __m256i rhs = _mm256_set1_epi8(b);
+        for (; last - first >= 32; first += 32) {
+            __m256i v =
+                _mm256_loadu_si256(reinterpret_cast<const __m256i*>(first));
+            unsigned int mask =
+                static_cast<unsigned int>(
+                    _mm256_movemask_epi8(
+                        _mm256_or_si256( _mm256_cmpeq_epi8(v, lhs),
+                                         _mm256_cmpeq_epi8(v, rhs) )
+                    )
+                );
+            if (mask != 0)
+                return first + lowest_bit(mask);
+        }
+    }
+#endif
+#if defined(BOOST_IOSTREAMS_HAS_SSE2)
+    if (last - first >= 16) {
+        __m128i lhs = _mm_set1_epi8(a);
+        __m128i rhs = _mm_set1_epi8(b);
+        for (; last - first >= 16; first += 16) {
+            __m128i v =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            int mask =
+                _mm_movemask_epi8(
+                    _mm_or_si128( _mm_cmpeq_epi8(v, lhs),
+                                  _mm_cmpeq_epi8(v, rhs) )
+                );
+            if (mask != 0)
+                return first + lowest_bit(static_cast<boost::uint64_t>(mask));
+        }
+    }
+#elif defined(BOOST_IOSTREAMS_HAS_NEON)
+    if (last - first >= 16) {
+        uint8x16_t lhs = vdupq_n_u8(static_cast<unsigned char>(a));
+        uint8x16_t rhs = vdupq_n_u8(static_cast<unsigned char>(b));
+        for (; last - first >= 16; first += 16) {
+            uint8x16_t v =
+                vld1q_u8(reinterpret_cast<const unsigned char*>(first));
+            uint8x16_t m = vorrq_u8(vceqq_u8(v, lhs), vceqq_u8(v, rhs));
+            boost::uint64_t mask =
+                vget_lane_u64(
+                    vreinterpret_u64_u8(
+                        vshrn_n_u16(vreinterpretq_u16_u8(m), 4)
+                    ), 0
+                );
+            if (mask != 0)
+                return first + lowest_bit(mask) / 4;
+        }
+    }
+#endif
+    for (; first != last; ++first)
+        if (*first == a || *first == b)
+            return first;
+    return last;
+}
+
+// Returns the first position in [first, last) holding c, or last.
+inline const char* find_char(const char* first, const char* last, char c)
+{
+    const void* p =
+        std::memchr(first, c, static_cast<std::size_t>(last - first));
+    return p ? static_cast<const char*>(p) : last;
+}
+
+// Returns the number of occurrences of c in [first, last). The vector loops
+// accumulate per-lane counts, which are summed before they can overflow.
+inline std::size_t count_char(const char* first, const char* last, char c)
+{
+    std::size_t result = 0;
+#if defined(BOOST_IOSTREAMS_HAS_AVX2)
+    if (last - first >= 32) {
+        const __m256i needle = _mm256_set1_epi8(c);
+        while (last - first >= 32) {
+            __m256i acc = _mm256_setzero_si256();
+            for ( int z = 0; z < 255 && last - first >= 32;
+                  ++z, first += 32 )
+            {
+                __m256i v =
+                    _mm256_loadu_si256(
+                        reinterpret_cast<const __m256i*>(first)
+                    );
+                acc = _mm256_sub_epi8(acc, _mm256_cmpeq_epi8(v, needle));
+            }
+            __m256i sum = _mm256_sad_epu8(acc, _mm256_setzero_si256());
+            result += static_cast<std::size_t>(
+                          _mm256_extract_epi64(sum, 0) +
+                          _mm256_extract_epi64(sum, 1) +
+                          _mm256_extract_epi64(sum, 2) +
+                          _mm256_extract_epi64(sum, 3)
+                      );
+        }
+    }
+#endif
+#if defined(BOOST_IOSTREAMS_HAS_SSE2)
+    if (last - first >= 16) {
+        const __m128i needle = _mm_set1_epi8(c);
+        while (last - first >= 16) {
+            __m128i acc = _mm_setzero_si128();
+            for ( int z = 0; z < 255 && last - first >= 16;
+                  ++z, first += 16 )
+            {
+                __m128i v =
+                    _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+                acc = _mm_sub_epi8(acc, _mm_cmpeq_epi8(v, needle));
+            }
+            __m128i sum = _mm_sad_epu8(acc, _mm_setzero_si128());
+            result += static_cast<std::size_t>(
+                          _mm_cvtsi128_si32(sum) +
+                          _mm_cvtsi128_si32(_mm_srli_si128(sum, 8))
+                      );
+        }
+    }
+#elif defined(BOOST_IOSTREAMS_HAS_NEON)
+    if (last - first >= 16) {
+        const uint8x16_t needle = vdupq_n_u8(static_cast<unsigned char>(c));
+        while (last - first >= 16) {
+            uint8x16_t acc = vdupq_n_u8(0);
+            for ( int z = 0; z < 255 && last - first >= 16;
+                  ++z, first += 16 )
+            {
+                uint8x16_t v =
+                    vld1q_u8(reinterpret_cast<const unsigned char*>(first));
+                acc = vsubq_u8(acc, vceqq_u8(v, needle));
+            }
+            uint64x2_t sum = vpaddlq_u32(vpaddlq_u16(vpaddlq_u8(acc)));
+            result += static_cast<std::size_t>(
+                          vgetq_lane_u64(sum, 0) + vgetq_lane_u64(sum, 1)
+                      );
+        }
+    }
+#endif
+    for (; first != last; ++first)
+        if (*first == c)
+            ++result;
+    return result;
+}
+
+// Portable versions of find_char and count_char, used for wide characters.
+template<typename Ch>
+inline const Ch* find_char(const Ch* first, const Ch* last, Ch c)
+{ return std::find(first, last, c); }
+
+template<typename Ch>
+inline std::size_t count_char(const Ch* first, const Ch* last, Ch c)
+{ return static_cast<std::size_t>(std::count(first, last, c)); }
+
+//
+// Class name: byte_set.
+// Description: Set of narrow characters which can locate the first member
+//      of the set in a buffer. Sets of up to max_vector characters are
+//      searched sixteen bytes at a time by comparing each byte with every
+//      member; a set of one character uses memchr. Larger sets are searched
+//      sixteen bytes at a time with SSSE3 or AArch64 NEON, by looking up
+//      the high four bits of each byte in a table of bitmaps indexed by its
+//      low four bits, and otherwise a byte at a time.
+//
+class byte_set {
+public:
+    BOOST_STATIC_CONSTANT(std::size_t, max_vector = 8);
+    byte_set() : size_(0)
+    {
+        std::memset(table_, 0, sizeof(table_));
+        std::memset(bytes_, 0, sizeof(bytes_));
+        std::memset(lower_, 0, sizeof(lower_));
+        std::memset(upper_, 0, sizeof(upper_));
+    }
+    void insert(unsigned char c)
+    {
+        if (table_[c])
+            return;
+        table_[c] = true;
+        if (size_ < max_vector)
+            bytes_[size_] = c;
+        (c < 0x80 ? lower_ : upper_)[c & 0x0F] |=
+            static_cast<unsigned char>(1 << ((c >> 4) & 7));
+        ++size_;
+    }
+    bool contains(unsigned char c) const { return table_[c]; }
+    std::size_t size() const { return size_; }
+    const char* find(const char* first, const char* last) const;
+private:
+    bool           table_[256];
+    unsigned char  bytes_[max_vector];
+
+    // Bit h of lower_[l] is set if 16 * h + l is a member, and likewise
+    // for upper_ and 128 + 16 * h + l.
+    unsigned char  lower_[16];
+    unsigned char  upper_[16];
+    std::size_t    size_;
+};
+
+inline const char* byte_set::find(const char* first, const char* last) const
+{
+    if (size_ == 0)
+        return last;
+    if (size_ == 1)
+        return find_char(first, last, static_cast<char>(bytes_[0]));
+    if (size_ == 2)
+        return find_either( first, last, static_cast<char>(bytes_[0]),
+                            static_cast<char>(bytes_[1]) );
+#if defined(BOOST_IOSTREAMS_HAS_SSE2)
+    if (size_ <= max_vector) {
+        __m128i needles[max_vector];
+        for (std::size_t z = 0; z < size_; ++z)
+            needles[z] = _mm_set1_epi8(static_cast<char>(bytes_[z]));
+        for (; last - first >= 16; first += 16) {
+            __m128i v =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i m = _mm_cmpeq_epi8(v, needles[0]);
+            for (std::size_t z = 1; z < size_; ++z)
+                m = _mm_or_si128(m, _mm_cmpeq_epi8(v, needles[z]));
+            int mask = _mm_movemask_epi8(m);
+            if (mask != 0)
+                return first + lowest_bit(static_cast<boost::uint64_t>(mask));
+        }
+    }
+#elif defined(BOOST_IOSTREAMS_HAS_NEON)
+    if (size_ <= max_vector) {
+        uint8x16_t needles[max_vector];
+        for (std::size_t z = 0; z < size_; ++z)
+            needles[z] = vdupq_n_u8(bytes_[z]);
+        for (; last - first >= 16; first += 16) {
+            uint8x16_t v =
+                vld1q_u8(reinterpret_cast<const unsigned char*>(first));
+            uint8x16_t m = vceqq_u8(v, needles[0]);
+            for (std::size_t z = 1; z < size_; ++z)
+                m = vorrq_u8(m, vceqq_u8(v, needles[z]));
+            // Narrow each byte of the comparison to four bits.
+            boost::uint64_t mask =
+                vget_lane_u64(
+                    vreinterpret_u64_u8(
+                        vshrn_n_u16(vreinterpretq_u16_u8(m), 4)
+                    ), 0
+                );
+            if (mask != 0)
+                return first + lowest_bit(mask) / 4;
+        }
+    }
+#endif
+#if defined(BOOST_IOSTREAMS_HAS_SSSE3)
+    if (size_ > max_vector && last - first >= 16) {
+        const __m128i lower =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(lower_));
+        const __m128i upper =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(upper_));
+        const __m128i bits =
+            _mm_setr_epi8(1, 2, 4, 8, 16, 32, 64, -128, 1, 2, 4, 8, 16, 32,
+                          64, -128);
+        const __m128i nibble = _mm_set1_epi8(0x0F);
+        for (; last - first >= 16; first += 16) {
+            __m128i v =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(first));
+            __m128i lo = _mm_and_si128(v, nibble);
+            __m128i hi = _mm_and_si128(_mm_srli_epi16(v, 4), nibble);
+            __m128i high_half = _mm_cmplt_epi8(v, _mm_setzero_si128());
+            __m128i row =
+                _mm_or_si128(
+                    _mm_andnot_si128(high_half, _mm_shuffle_epi8(lower, lo)),
+                    _mm_and_si128(high_half, _mm_shuffle_epi8(upper, lo))
+                );
+            __m128i bit = _mm_shuffle_epi8(bits, hi);
+            int mask =
+                _mm_movemask_epi8(
+                    _mm_cmpeq_epi8(_mm_and_si128(row, bit), bit)
+                );
+            if (mask != 0)
+                return first + lowest_bit(static_cast<boost::uint64_t>(mask));
+        }
+    }
+#elif defined(BOOST_IOSTREAMS_HAS_NEON) && \
+      (defined(__aarch64__) || defined(_M_ARM64)) \
+      /**/
+    if (size_ > max_vector && last - first >= 16) {
+        const uint8x16_t lower = vld1q_u8(lower_);
+        const uint8x16_t upper = vld1q_u8(upper_);
+        static const unsigned char bit_values[16] =
+            { 1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128 };
+        const uint8x16_t bits = vld1q_u8(bit_values);
+        const uint8x16_t nibble = vdupq_n_u8(0x0F);
+        for (; last - first >= 16; first += 16) {
+            uint8x16_t v =
+                vld1q_u8(reinterpret_cast<const unsigned char*>(first));
+            uint8x16_t row =
+                vbslq_u8( vtstq_u8(v, vdupq_n_u8(0x80)),
+                          vqtbl1q_u8(upper, vandq_u8(v, nibble)),
+                          vqtbl1q_u8(lower, vandq_u8(v, nibble)) );
+            uint8x16_t bit = vqtbl1q_u8(bits, vshrq_n_u8(v, 4));
+            uint8x16_t m = vtstq_u8(row, bit);
+            boost::uint64_t mask =
+                vget_lane_u64(
+                    vreinterpret_u64_u8(
+                        vshrn_n_u16(vreinterpretq_u16_u8(m), 4)
+                    ), 0
+                );
+            if (mask != 0)
+                return first + lowest_bit(mask) / 4;
+        }
+    }
+#endif
+    for (; first != last; ++first)
+        if (table_[static_cast<unsigned char>(*first)])
+            return first;
+    return last;
+}
+
+} } } // End namespaces detail, iostreams, boost.
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_SCAN_HPP_INCLUDED
@@ -0,0 +1,377 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Contains the definitions of the class spill_file, an anonymous temporary
+// file which can be mapped into memory, and the class template spool, a
+// character buffer which moves its contents to a spill_file once they
+// exceed a given size. Used by aggregate_filter and async_tee.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_SPOOL_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_SPOOL_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <cstddef>                                     // size_t.
+#include <memory>                                      // allocator.
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/iostreams/detail/config/rtl.hpp>       // FD_SEEK, FD_OFFSET.
+#include <boost/iostreams/detail/config/windows_posix.hpp>
+#include <boost/iostreams/detail/ios.hpp>              // streamsize.
+#include <boost/iostreams/detail/system_failure.hpp>
+#include <boost/iostreams/positioning.hpp>             // stream_offset.
+#include <boost/throw_exception.hpp>
+#ifdef BOOST_IOSTREAMS_WINDOWS
+# define WIN32_LEAN_AND_MEAN  // Exclude rarely-used stuff from Windows headers
+# include <windows.h>
+#else
+# include <errno.h>
+# include <fcntl.h>                                    // open, O_TMPFILE.
+# include <stdlib.h>                                   // getenv, mkstemp.
+# include <string>
+# include <sys/mman.h>                                 // mmap, munmap.
+# include <unistd.h>                             // close, lseek, read, write.
+#endif
+
+namespace boost { namespace iostreams { namespace detail {
+
+//
+// Class name: spill_file.
+// Description: Temporary file which is removed from the file system as soon
+//      as it is created, or, on Windows, when it is closed. Data is written
+//      with write() at the current position, which is initially the start of
+//      the file and may be changed with seek(); it may be read back with
+//      read(), or the whole file may be mapped read-only with map().
+//
+class spill_file {
+public:
+    spill_file() { init(); }
+    ~spill_file() { close(); }
+    bool is_open() const
+    {
+    #ifdef BOOST_IOSTREAMS_WINDOWS
+        return handle_ != INVALID_HANDLE_VALUE;
+    #else
+        return fd_ != -1;
+    #endif
+    }
+    void open();
+    void seek(stream_offset off);
+    void write(const char* s, std::size_t n);
+
+    // Reads exactly n bytes at the current position.
+    void read(char* s, std::size_t n);
+
+    // Maps the first size bytes of the file, which must be non-zero.
+    const char* map(std::size_t size);
+    void close();
+private:
+    spill_file(const spill_file&);
+    spill_file& operator=(const spill_file&);
+    void init()
+    {
+    #ifdef BOOST_IOSTREAMS_WINDOWS
+        handle_ = INVALID_HANDLE_VALUE;
+        mapping_ = NULL;
+    #else
+        fd_ = -1;
+    #endif
+        data_ = 0;
+        size_ = 0;
+    }
+    void unmap();
+#ifdef BOOST_IOSTREAMS_WINDOWS
+    HANDLE       handle_;
+    HANDLE       mapping_;
+#else
+    int          fd_;
+#endif
+    const char*  data_;
+    std::size_t  size_;
+};
+
+//------------------Implementation of spill_file------------------------------//
+
+#ifdef BOOST_IOSTREAMS_WINDOWS
+
+inline void spill_file::open()
+{
+    close();
+    char dir[MAX_PATH + 1];
+    char path[MAX_PATH + 1];
+    DWORD len = ::GetTempPathA(MAX_PATH + 1, dir);
+    if ( len == 0 || len > MAX_PATH ||
+         ::GetTempFileNameA(dir, "bio", 0, path) == 0 )
+    {
+        throw_system_failure("failed creating temporary file");
+    }
+    handle_ = ::CreateFileA( path, GENERIC_READ | GENERIC_WRITE, 0, NULL,
+                             CREATE_ALWAYS,
+                             FILE_ATTRIBUTE_TEMPORARY |
+                                 FILE_FLAG_DELETE_ON_CLOSE,
+                             NULL );
+    if (handle_ == INVALID_HANDLE_VALUE)
+        throw_system_failure("failed creating temporary file");
+}
+
+inline void spill_file::seek(stream_offset off)
+{
+    LARGE_INTEGER pos;
+    pos.QuadPart = off;
+    if (!::SetFilePointerEx(handle_, pos, NULL, FILE_BEGIN))
+        throw_system_failure("failed seeking temporary file");
+}
+
+inline void spill_file::write(const char* s, std::size_t n)
+{
+    unmap();
+    while (n != 0) {
+        DWORD amt = n > 0x40000000 ? 0x40000000 : static_cast<DWORD>(n);
+        DWORD result;
+        if (!::WriteFile(handle_, s, amt, &result, NULL))
+            throw_system_failure("failed writing temporary file");
+        s += result;
+        n -= result;
+    }
+}
+
+inline void spill_file::read(char* s, std::size_t n)
+{
+    while (n != 0) {
+        DWORD amt = n > 0x40000000 ? 0x40000000 : static_cast<DWORD>(n);
+        DWORD result;
+        if (!::ReadFile(handle_, s, amt, &result, NULL) || result == 0)
+            throw_system_failure("failed reading temporary file");
+        s += result;
+        n -= result;
+    }
+}
+
+inline const char* spill_file::map(std::size_t size)
+{
+    if (data_ != 0 && size_ == size)
+        return data_;
+    unmap();
+    mapping_ = ::CreateFileMappingA(handle_, NULL, PAGE_READONLY, 0, 0, NULL);
+    if (mapping_ == NULL)
+        throw_system_failure("failed mapping temporary file");
+    data_ = static_cast<const char*>(
+                ::MapViewOfFile(mapping_, FILE_MAP_READ, 0, 0, size)
+            );
+    if (data_ == 0)
+        throw_system_failure("failed mapping temporary file");
+    size_ = size;
+    return data_;
+}
+
+inline void spill_file::unmap()
+{
+    if (data_ != 0)
+        ::UnmapViewOfFile(data_);
+    if (mapping_ != NULL)
+        ::CloseHandle(mapping_);
+    mapping_ = NULL;
+    data_ = 0;
+    size_ = 0;
+}
+
+inline void spill_file::close()
+{
+    unmap();
+    if (handle_ != INVALID_HANDLE_VALUE)
+        ::CloseHandle(handle_);
+    handle_ = INVALID_HANDLE_VALUE;
+}
+
+#else // #ifdef BOOST_IOSTREAMS_WINDOWS
+
+inline void spill_file::open()
+{
+    close();
+    const char* dir = ::getenv("TMPDIR");
+    if (dir == 0 || *dir == 0)
+        dir = "/tmp";
+#ifdef O_TMPFILE
+    // Creates an unnamed file where supported by the file system.
+    fd_ = ::open(dir, O_TMPFILE | O_RDWR | O_EXCL, 0600);
+    if (fd_ != -1)
+        return;
+#endif
+    std::string path(dir);
+    path += "/boost_iostreams_XXXXXX";
+    fd_ = ::mkstemp(&path[0]);
+    if (fd_ == -1)
+        throw_system_failure("failed creating temporary file");
+    ::unlink(path.c_str());
+}
+
+inline void spill_file::seek(stream_offset off)
+{
+    typedef BOOST_IOSTREAMS_FD_OFFSET offset_type;
+    offset_type pos = static_cast<offset_type>(off);
+    if (BOOST_IOSTREAMS_FD_SEEK(fd_, pos, SEEK_SET) == -1)
+        throw_system_failure("failed seeking temporary file");
+}
+
+inline void spill_file::write(const char* s, std::size_t n)
+{
+    unmap();
+    while (n != 0) {
+        ssize_t result = ::write(fd_, s, n);
+        if (result == -1) {
+            if (errno == EINTR)
+                continue;
+            throw_system_failure("failed writing temporary file");
+        }
+        s += result;
+        n -= static_cast<std::size_t>(result);
+    }
+}
+
+inline void spill_file::read(char* s, std::size_t n)
+{
+    while (n != 0) {
+        ssize_t result = ::read(fd_, s, n);
+        if (result == -1 && errno == EINTR)
+            continue;
+        if (result <= 0)
+            throw_system_failure("failed reading temporary file");
+        s += result;
+        n -= static_cast<std::size_t>(result);
+    }
+}
+
+inline const char* spill_file::map(std::size_t size)
+{
+    if (data_ != 0 && size_ == size)
+        return data_;
+    unmap();
+    void* data = ::mmap(0, size, PROT_READ, MAP_SHARED, fd_, 0);
+    if (data == MAP_FAILED)
+        throw_system_failure("failed mapping temporary file");
+    data_ = static_cast<const char*>(data);
+    size_ = size;
+    return data_;
+}
+
+inline void spill_file::unmap()
+{
+    if (data_ != 0)
+        ::munmap(const_cast<char*>(data_), size_);
+    data_ = 0;
+    size_ = 0;
+}
+
+inline void spill_file::close()
+{
+    unmap();
+    if (fd_ != -1)
+        ::close(fd_);
+    fd_ = -1;
+}
+
+#endif // #ifdef BOOST_IOSTREAMS_WINDOWS
+
+//
+// Template name: spool.
+// Template parameters:
+//      Ch - The character type.
+//      Alloc - The allocator type.
+// Description: Character sequence which is held in memory until its length
+//      exceeds a given limit, after which it is moved to a spill_file; the
+//      memory buffer then serves to batch writes to the file. A limit of
+//      zero means the sequence is always held in memory. A spool may be
+//      copied only while its contents are held in memory.
+//
+template<typename Ch, typename Alloc = std::allocator<Ch> >
+class spool {
+public:
+    typedef Ch char_type;
+    explicit spool(std::streamsize limit = 0)
+        : limit_(static_cast<size_type>(limit)), size_(0)
+        { }
+    spool(const spool& other)
+        : buf_(other.buf_), limit_(other.limit_), size_(0)
+        { other.check_copyable(); }
+    spool& operator=(const spool& other)
+    {
+        if (this != &other) {
+            other.check_copyable();
+            clear();
+            buf_ = other.buf_;
+            limit_ = other.limit_;
+        }
+        return *this;
+    }
+    std::streamsize size() const
+    { return static_cast<std::streamsize>(size_ + buf_.size()); }
+    bool spilled() const { return file_.is_open(); }
+    void write(const char_type* s, std::streamsize n)
+    {
+        size_type amt = static_cast<size_type>(n);
+        if (limit_ != 0 && buf_.size() + amt > limit_) {
+            if (!file_.is_open())
+                file_.open();
+            flush();
+            if (amt > limit_) {
+                file_.write( reinterpret_cast<const char*>(s),
+                             amt * sizeof(char_type) );
+                size_ += amt;
+                return;
+            }
+        }
+        buf_.insert(buf_.end(), s, s + amt);
+    }
+
+    // Returns a pointer to the contents, which remains valid until the next
+    // call to a non-const member function other than data().
+    const char_type* data()
+    {
+        if (!file_.is_open())
+            return buf_.empty() ? 0 : &buf_[0];
+        flush();
+        return size_ == 0 ?
+            0 :
+            reinterpret_cast<const char_type*>(
+                file_.map(size_ * sizeof(char_type))
+            );
+    }
+    void clear()
+    {
+        vector_type().swap(buf_);
+        file_.close();
+        size_ = 0;
+    }
+private:
+    typedef std::vector<Ch, Alloc>           vector_type;
+    typedef typename vector_type::size_type  size_type;
+    void check_copyable() const
+    {
+        if (file_.is_open())
+            boost::throw_exception(
+                BOOST_IOSTREAMS_FAILURE("cannot copy a spilled buffer")
+            );
+    }
+    void flush()
+    {
+        if (buf_.empty())
+            return;
+        file_.write( reinterpret_cast<const char*>(&buf_[0]),
+                     buf_.size() * sizeof(char_type) );
+        size_ += buf_.size();
+        buf_.clear();
+    }
+    vector_type  buf_;
+    spill_file   file_;
+    size_type    limit_;
+    size_type    size_;   // Number of characters in file_.
+};
+
+} } } // End namespaces detail, iostreams, boost.
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_SPOOL_HPP_INCLUDED
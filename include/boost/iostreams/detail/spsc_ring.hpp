@@ -0,0 +1,198 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Contains the definition of the class template spsc_ring, a bounded
+// single-producer, single-consumer queue of characters used to pass data
+// between threads. Requires C++11 <atomic>, <condition_variable>, <mutex>
+// and <thread>.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_SPSC_RING_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_SPSC_RING_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC) || \
+    defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE) || \
+    defined(BOOST_NO_CXX11_HDR_MUTEX) || \
+    defined(BOOST_NO_CXX11_HDR_THREAD)
+# error "Boost.Iostreams: threaded components require C++11 threading support"
+#endif
+
+#include <algorithm>                    // min.
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>                      // size_t.
+#include <mutex>
+#include <stdexcept>                    // length_error.
+#include <thread>                       // yield.
+#include <vector>
+#include <boost/throw_exception.hpp>
+
+namespace boost { namespace iostreams { namespace detail {
+
+//
+// Template name: spsc_ring.
+// Template parameters:
+//      T - The element type.
+// Description: Bounded queue with one producer and one consumer thread. The
+//      producer obtains contiguous free space with writable() and publishes
+//      it with commit(); the consumer obtains contiguous data with readable()
+//      and releases it with consume(). Neither operation takes a lock.
+//      Either thread may block in wait() until a condition holds; progress
+//      on the other side is signalled with notify(), which takes a lock only
+//      if a thread is waiting. Any other state examined by a condition must
+//      be stored with memory_order_seq_cst before notify() is called, since
+//      notify() would otherwise miss a thread which has just begun waiting.
+//
+template<typename T>
+class spsc_ring {
+public:
+    // Capacity is rounded up to a power of two.
+    explicit spsc_ring(std::size_t capacity)
+        : head_(0), tail_(0), waiters_(0)
+    {
+        if (capacity > static_cast<std::size_t>(-1) / 2 + 1)
+            boost::throw_exception(std::length_error("bad ring capacity"));
+        std::size_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+        buf_.resize(size);
+        mask_ = size - 1;
+    }
+    std::size_t capacity() const { return buf_.size(); }
+    std::size_t size() const
+    {
+        return head_.load(std::memory_order_acquire) -
+               tail_.load(std::memory_order_acquire);
+    }
+    bool empty() const { return size() == 0; }
+
+    //----------Producer interface--------------------------------------------//
+
+    // Returns the number of elements which may be stored contiguously at p.
+    std::size_t writable(T*& p)
+    {
+        std::size_t head = head_.load(std::memory_order_relaxed);
+        std::size_t tail = tail_.load(std::memory_order_acquire);
+        std::size_t offset = head & mask_;
+        p = &buf_[offset];
+        return (std::min)(capacity() - (head - tail), capacity() - offset);
+    }
+    void commit(std::size_t n)
+    {
+        head_.store( head_.load(std::memory_order_relaxed) + n,
+                     std::memory_order_seq_cst );
+        notify();
+    }
+
+    // Copies up to n elements into the ring, returning the number copied.
+    std::size_t write(const T* s, std::size_t n)
+    {
+        std::size_t result = 0;
+        T* p;
+        std::size_t amt;
+        while (result < n && (amt = writable(p)) != 0) {
+            amt = (std::min)(amt, n - result);
+            std::copy(s + result, s + result + amt, p);
+            result += amt;
+            head_.store( head_.load(std::memory_order_relaxed) + amt,
+                         std::memory_order_seq_cst );
+        }
+        if (result != 0)
+            notify();
+        return result;
+    }
+
+    //----------Consumer interface--------------------------------------------//
+
+    // Returns the number of elements which may be read contiguously at p.
+    std::size_t readable(const T*& p)
+    {
+        std::size_t tail = tail_.load(std::memory_order_relaxed);
+        std::size_t head = head_.load(std::memory_order_acquire);
+        std::size_t offset = tail & mask_;
+        p = &buf_[offset];
+        return (std::min)(head - tail, capacity() - offset);
+    }
+    void consume(std::size_t n)
+    {
+        tail_.store( tail_.load(std::memory_order_relaxed) + n,
+                     std::memory_order_seq_cst );
+        notify();
+    }
+
+    // Copies up to n elements from the ring, returning the number copied.
+    std::size_t read(T* s, std::size_t n)
+    {
+        std::size_t result = 0;
+        const T* p;
+        std::size_t amt;
+        while (result < n && (amt = readable(p)) != 0) {
+            amt = (std::min)(amt, n - result);
+            std::copy(p, p + amt, s + result);
+            result += amt;
+            tail_.store( tail_.load(std::memory_order_relaxed) + amt,
+                         std::memory_order_seq_cst );
+        }
+        if (result != 0)
+            notify();
+        return result;
+    }
+
+    //----------Synchronization-----------------------------------------------//
+
+    // Blocks until pred() returns true; pred is re-evaluated after each call
+    // to notify().
+    template<typename Pred>
+    void wait(Pred pred)
+    {
+        for (int z = 0; z < spin_count; ++z) {
+            if (pred())
+                return;
+            std::this_thread::yield();
+        }
+        std::unique_lock<std::mutex> lock(mutex_);
+        waiters_.fetch_add(1, std::memory_order_seq_cst);
+        while (!pred())
+            cond_.wait(lock);
+        waiters_.fetch_sub(1, std::memory_order_seq_cst);
+    }
+
+    // Wakes any thread blocked in wait(). Must be called after any change
+    // to state examined by a predicate passed to wait().
+    void notify()
+    {
+        if (waiters_.load(std::memory_order_seq_cst) != 0) {
+            std::lock_guard<std::mutex> lock(mutex_);
+            cond_.notify_all();
+        }
+    }
+private:
+    enum { spin_count = 64 };
+    spsc_ring(const spsc_ring&);
+    spsc_ring& operator=(const spsc_ring&);
+
+    // The counters are kept on separate cache lines from each other and from
+    // the remaining members.
+    char                      pad0_[64];
+    std::atomic<std::size_t>  head_;  // Elements written.
+    char                      pad1_[64];
+    std::atomic<std::size_t>  tail_;  // Elements read.
+    char                      pad2_[64];
+    std::atomic<int>          waiters_;
+    std::vector<T>            buf_;
+    std::size_t               mask_;
+    std::mutex                mutex_;
+    std::condition_variable   cond_;
+};
+
+} } } // End namespaces detail, iostreams, boost.
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_SPSC_RING_HPP_INCLUDED
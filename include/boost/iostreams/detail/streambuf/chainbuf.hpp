@@ -12,6 +12,7 @@
 # pragma once
 #endif      
 
+#include <utility>                            // pair.
 #include <boost/config.hpp>                    // BOOST_MSVC, template friends.
 #include <boost/detail/workaround.hpp>
 #include <boost/iostreams/chain.hpp>
@@ -48,6 +49,30 @@ private:
 public:
     typedef typename Chain::char_type                        char_type;
     BOOST_IOSTREAMS_STREAMBUF_TYPEDEFS(typename Chain::traits_type)
+    std::pair<const char_type*, const char_type*>
+    peek_window(std::streamsize n = 1)
+        { sentry t(this); return delegate().peek_window(n); }
+    void consume(std::streamsize n)
+        { sentry t(this); delegate().consume(n); }
+    std::pair<char_type*, char_type*> reserve(std::streamsize n = 1)
+        { sentry t(this); return delegate().reserve(n); }
+    void commit(std::streamsize n)
+        { sentry t(this); delegate().commit(n); }
+    void rewind()
+        {
+            if (!chain_.empty()) {
+                sentry t(this);
+                chain_.rewind();
+            }
+        }
+    template<typename Device>
+    void reopen(const Device& dev)
+        {
+            if (!chain_.empty())
+                set_pointers();
+            chain_.reopen(dev);
+            get_pointers();
+        }
 protected:
     typedef linked_streambuf<char_type, traits_type>         delegate_type;
     chainbuf() { client_type::set_chain(&chain_); }
@@ -13,6 +13,7 @@
 #endif              
 
 #include <boost/assert.hpp>
+#include <climits>                                 // INT_MAX.
 #include <cstddef>
 #include <utility>                                 // pair.
 #include <boost/config.hpp>                        // BOOST_DEDUCED_TYPENAME, 
@@ -58,6 +59,7 @@ private:
 public: // stream needs access.
     void open(const T& t, std::streamsize buffer_size, 
               std::streamsize pback_size);
+    void replace_component(const T& t);
     bool is_open() const;
     void close();
     bool auto_close() const { return auto_close_; }
@@ -76,6 +78,7 @@ protected:
     void close_impl(BOOST_IOS::openmode m);
     const boost::core::typeinfo& component_type() const { return BOOST_CORE_TYPEID(T); }
     void* component_impl() { return component(); } 
+    void rewind_impl();
 #ifdef BOOST_IOSTREAMS_NO_STREAM_TEMPLATES
     public:
 #endif
@@ -94,6 +97,10 @@ private:
     void init_input(input);
     void init_output(any_tag) { }
     void init_output(output);
+    bool grow_output(any_tag) { return false; }
+    bool grow_output(growable_tag);
+    void shrink_output(any_tag) { }
+    void shrink_output(growable_tag);
     void init_get_area();
     void init_put_area();
     bool one_head() const;
@@ -122,6 +129,13 @@ void direct_streambuf<T, Tr>::open
     this->set_needs_close();
 }
 
+template<typename T, typename Tr>
+void direct_streambuf<T, Tr>::replace_component(const T& t)
+{
+    storage_.reset(t);
+    this->rewind();
+}
+
 template<typename T, typename Tr>
 bool direct_streambuf<T, Tr>::is_open() const 
 { return ibeg_ != 0 || obeg_ != 0; }
@@ -173,7 +187,7 @@ direct_streambuf<T, Tr>::overflow(int_type c)
         boost::throw_exception(BOOST_IOSTREAMS_FAILURE("no write access"));
     if (!pptr()) init_put_area();
     if (!traits_type::eq_int_type(c, traits_type::eof())) {
-        if (pptr() == oend_)
+        if (pptr() == oend_ && !grow_output(category()))
             boost::throw_exception(
                 BOOST_IOSTREAMS_FAILURE("write area exhausted")
             );
@@ -207,12 +221,22 @@ void direct_streambuf<T, Tr>::close_impl(BOOST_IOS::openmode which)
     }
     if (which == BOOST_IOS::out && obeg_ != 0) {
         sync();
+        shrink_output(category());
         setp(0, 0);
         obeg_ = oend_ = 0;
     }
     boost::iostreams::close(*storage_, which);
 }
 
+template<typename T, typename Tr>
+void direct_streambuf<T, Tr>::rewind_impl()
+{
+    init_input(category());
+    init_output(category());
+    setg(0, 0, 0);
+    setp(0, 0);
+}
+
 template<typename T, typename Tr>
 typename direct_streambuf<T, Tr>::pos_type direct_streambuf<T, Tr>::seek_impl
     (stream_offset off, BOOST_IOS::seekdir way, BOOST_IOS::openmode which)
@@ -272,6 +296,41 @@ void direct_streambuf<T, Tr>::init_output(output)
     oend_ = p.second;
 }
 
+// Sinks whose category is convertible to growable_tag have an output sequence
+// which can be enlarged as it fills up, as well as the following members:
+//
+//   pair_type grow_output_sequence(std::streamsize used) - Returns a longer
+//       output sequence whose first used characters are those of the
+//       current sequence.
+//   void shrink_output_sequence(std::streamsize used) - Indicates that the
+//       first used characters of the output sequence have been written and
+//       that the remainder can be discarded; called before close().
+//
+template<typename T, typename Tr>
+bool direct_streambuf<T, Tr>::grow_output(growable_tag)
+{
+    std::streamsize used = static_cast<std::streamsize>(pptr() - obeg_);
+    std::pair<char_type*, char_type*> p =
+        storage_->grow_output_sequence(used);
+    obeg_ = p.first;
+    oend_ = p.second;
+    setp(obeg_, oend_);
+    while (used > 0) {
+        int amt = used < INT_MAX ? static_cast<int>(used) : INT_MAX;
+        pbump(amt);
+        used -= amt;
+    }
+    return pptr() != oend_;
+}
+
+template<typename T, typename Tr>
+void direct_streambuf<T, Tr>::shrink_output(growable_tag)
+{
+    storage_->shrink_output_sequence(
+        pptr() ? static_cast<std::streamsize>(pptr() - obeg_) : 0
+    );
+}
+
 template<typename T, typename Tr>
 void direct_streambuf<T, Tr>::init_get_area()
 {
@@ -16,6 +16,7 @@
 #include <algorithm>                             // min, max.
 #include <cassert>
 #include <exception>
+#include <utility>                               // pair.
 #include <boost/config.hpp>                      // Member template friends.
 #include <boost/detail/workaround.hpp>
 #include <boost/core/typeinfo.hpp>
@@ -64,6 +65,7 @@ public:
     indirect_streambuf();
 
     void open(const T& t BOOST_IOSTREAMS_PUSH_PARAMS());
+    void replace_component(const T& t);
     bool is_open() const;
     void close();
     bool auto_close() const;
@@ -85,7 +87,9 @@ protected:
 #endif
     int_type underflow();
     int_type pbackfail(int_type c);
+    std::streamsize xsgetn(char_type* s, std::streamsize n);
     int_type overflow(int_type c);
+    std::streamsize xsputn(const char_type* s, std::streamsize n);
     int sync();
     pos_type seekoff( off_type off, BOOST_IOS::seekdir way,
                       BOOST_IOS::openmode which );
@@ -96,6 +100,10 @@ protected:
     void close_impl(BOOST_IOS::openmode m);
     const boost::core::typeinfo& component_type() const { return BOOST_CORE_TYPEID(T); }
     void* component_impl() { return component(); }
+    void rewind_impl();
+    std::pair<const char_type*, const char_type*>
+    peek_window_impl(std::streamsize n);
+    std::pair<char_type*, char_type*> reserve_impl(std::streamsize n);
 private:
 
     //----------Accessor functions--------------------------------------------//
@@ -190,6 +198,16 @@ void indirect_streambuf<T, Tr, Alloc, Mode>::open
     this->set_needs_close();
 }
 
+// Replaces the component of a link which has been closed, retaining the
+// buffers.
+template<typename T, typename Tr, typename Alloc, typename Mode>
+void indirect_streambuf<T, Tr, Alloc, Mode>::replace_component(const T& t)
+{
+    storage_.reset(wrapper(t));
+    flags_ |= f_open;
+    this->rewind();
+}
+
 template<typename T, typename Tr, typename Alloc, typename Mode>
 inline bool indirect_streambuf<T, Tr, Alloc, Mode>::is_open() const
 { return (flags_ & f_open) != 0; }
@@ -278,6 +296,51 @@ indirect_streambuf<T, Tr, Alloc, Mode>::pbackfail(int_type c)
     }
 }
 
+template<typename T, typename Tr, typename Alloc, typename Mode>
+std::streamsize indirect_streambuf<T, Tr, Alloc, Mode>::xsgetn
+    (char_type* s, std::streamsize n)
+{
+    if (!can_read())
+        return base_type::xsgetn(s, n);
+    if (!gptr()) init_get_area();
+
+    // Copy buffered characters.
+    std::streamsize result =
+        (std::min)(n, static_cast<std::streamsize>(egptr() - gptr()));
+    if (result) {
+        traits_type::copy(s, gptr(), result);
+        gbump(static_cast<int>(result));
+    }
+
+    // Requests smaller than the buffer are satisfied through the buffer;
+    // larger requests are passed to the component directly.
+    buffer_type& buf = in();
+    if (n - result < buf.size() - pback_size_)
+        return result + base_type::xsgetn(s + result, n - result);
+    std::streamsize start = result;
+    while (result < n) {
+        std::streamsize amt = obj().read(s + result, n - result, next_);
+        if (amt == -1) {
+            this->set_true_eof(true);
+            break;
+        }
+        if (amt == 0)
+            break;
+        result += amt;
+    }
+
+    // Retain the last characters read for use by putback().
+    if (result != start) {
+        std::streamsize keep = (std::min)(result, pback_size_);
+        traits_type::copy( buf.data() + (pback_size_ - keep),
+                           s + result - keep, keep );
+        setg( buf.data() + pback_size_ - keep,
+              buf.data() + pback_size_,
+              buf.data() + pback_size_ );
+    }
+    return result;
+}
+
 template<typename T, typename Tr, typename Alloc, typename Mode>
 typename indirect_streambuf<T, Tr, Alloc, Mode>::int_type
 indirect_streambuf<T, Tr, Alloc, Mode>::overflow(int_type c)
@@ -305,6 +368,33 @@ indirect_streambuf<T, Tr, Alloc, Mode>::overflow(int_type c)
     return traits_type::not_eof(c);
 }
 
+template<typename T, typename Tr, typename Alloc, typename Mode>
+std::streamsize indirect_streambuf<T, Tr, Alloc, Mode>::xsputn
+    (const char_type* s, std::streamsize n)
+{
+    if (!can_write() || (output_buffered() && n < out().size()))
+        return base_type::xsputn(s, n);
+    if ( (output_buffered() && pptr() == 0) ||
+         (shared_buffer() && gptr() != 0) )
+    {
+        init_put_area();
+    }
+
+    // Write buffered characters, then pass the request to the component
+    // directly instead of copying it through the buffer.
+    sync_impl();
+    if (pptr() != pbase())
+        return base_type::xsputn(s, n);
+    std::streamsize result = 0;
+    while (result < n) {
+        std::streamsize amt = obj().write(s + result, n - result, next_);
+        if (amt <= 0)
+            break;
+        result += amt;
+    }
+    return result;
+}
+
 template<typename T, typename Tr, typename Alloc, typename Mode>
 int indirect_streambuf<T, Tr, Alloc, Mode>::sync()
 {
@@ -374,6 +464,101 @@ indirect_streambuf<T, Tr, Alloc, Mode>::seek_impl
     return obj().seek(off, way, which, next_);
 }
 
+template<typename T, typename Tr, typename Alloc, typename Mode>
+std::pair<
+    const typename indirect_streambuf<T, Tr, Alloc, Mode>::char_type*,
+    const typename indirect_streambuf<T, Tr, Alloc, Mode>::char_type*
+>
+indirect_streambuf<T, Tr, Alloc, Mode>::peek_window_impl(std::streamsize n)
+{
+    typedef std::pair<const char_type*, const char_type*> result_type;
+    if (!can_read())
+        boost::throw_exception(cant_read());
+    if (!gptr()) init_get_area();
+    n = (std::max)(n, std::streamsize(1));
+    if (egptr() - gptr() >= n)
+        return result_type(gptr(), egptr());
+
+    // Move the unread characters, together with the putback characters
+    // preceding them, to the start of a buffer large enough for n
+    // characters.
+    std::streamsize avail = static_cast<std::streamsize>(egptr() - gptr());
+    std::streamsize keep =
+        (std::min)( static_cast<std::streamsize>(gptr() - eback()),
+                    pback_size_ );
+    buffer_type& buf = in();
+    if (buf.size() - pback_size_ < n) {
+        buffer_type temp(pback_size_ + n);
+        traits_type::copy( temp.data() + (pback_size_ - keep),
+                           gptr() - keep, keep + avail );
+        buf.swap(temp);
+    } else {
+        traits_type::move( buf.data() + (pback_size_ - keep),
+                           gptr() - keep, keep + avail );
+    }
+    setg( buf.data() + pback_size_ - keep,
+          buf.data() + pback_size_,
+          buf.data() + pback_size_ + avail );
+
+    // Read until n characters are available.
+    while (egptr() - gptr() < n) {
+        std::streamsize chars =
+            obj().read(egptr(), buf.end() - egptr(), next_);
+        if (chars == -1) {
+            this->set_true_eof(true);
+            break;
+        }
+        if (chars == 0)
+            break;
+        setg(eback(), gptr(), egptr() + chars);
+    }
+    return result_type(gptr(), egptr());
+}
+
+template<typename T, typename Tr, typename Alloc, typename Mode>
+void indirect_streambuf<T, Tr, Alloc, Mode>::rewind_impl()
+{
+    setg(0, 0, 0);
+    setp(0, 0);
+    if (can_read() && !shared_buffer())
+        init_get_area();
+    if (can_write() && !shared_buffer())
+        init_put_area();
+    this->set_true_eof(false);
+}
+
+template<typename T, typename Tr, typename Alloc, typename Mode>
+std::pair<
+    typename indirect_streambuf<T, Tr, Alloc, Mode>::char_type*,
+    typename indirect_streambuf<T, Tr, Alloc, Mode>::char_type*
+>
+indirect_streambuf<T, Tr, Alloc, Mode>::reserve_impl(std::streamsize n)
+{
+    typedef std::pair<char_type*, char_type*> result_type;
+    if (!can_write())
+        boost::throw_exception(cant_write());
+    if ( (output_buffered() && pptr() == 0) ||
+         (shared_buffer() && gptr() != 0) )
+    {
+        init_put_area();
+    }
+    n = (std::max)(n, std::streamsize(1));
+    if (epptr() - pptr() >= n)
+        return result_type(pptr(), epptr());
+
+    // Write the buffered characters; if the buffer is then empty but still
+    // too small, enlarge it, in which case output is buffered from now on.
+    sync_impl();
+    if (epptr() - pptr() < n && pptr() == pbase()) {
+        buffer_type& buf = out();
+        if (buf.size() < n)
+            buf.resize(n);
+        flags_ |= f_output_buffered;
+        setp(buf.begin(), buf.end());
+    }
+    return result_type(pptr(), epptr());
+}
+
 template<typename T, typename Tr, typename Alloc, typename Mode>
 inline void indirect_streambuf<T, Tr, Alloc, Mode>::set_next
     (streambuf_type* next)
@@ -12,6 +12,8 @@
 # pragma once
 #endif
 
+#include <utility>                                 // pair.
+#include <boost/assert.hpp>
 #include <boost/config.hpp>                        // member template friends.
 #include <boost/core/typeinfo.hpp>
 #include <boost/iostreams/detail/char_traits.hpp>
@@ -50,6 +52,33 @@ public:
     // Should be called only after receiving an ordinary EOF indication,
     // to confirm that it represents EOF rather than WOULD_BLOCK.
     bool true_eof() const { return (flags_ & f_true_eof) != 0; }
+
+    // Returns the characters in the get area, reading more if fewer than n
+    // are available; fewer than n characters are returned only at the end
+    // of the sequence or if no more are available without blocking.
+    std::pair<const Ch*, const Ch*> peek_window(std::streamsize n = 1)
+    { return peek_window_impl(n); }
+
+    // Discards the first n characters of the get area.
+    void consume(std::streamsize n)
+    {
+        BOOST_ASSERT(0 <= n && n <= this->egptr() - this->gptr());
+        this->gbump(static_cast<int>(n));
+    }
+
+    // Returns the free space in the put area, making room for at least n
+    // characters if less is available, unless the buffered characters
+    // cannot be written without blocking.
+    std::pair<Ch*, Ch*> reserve(std::streamsize n = 1)
+    { return reserve_impl(n); }
+
+    // Appends to the put area the first n characters of the space returned
+    // by reserve().
+    void commit(std::streamsize n)
+    {
+        BOOST_ASSERT(0 <= n && n <= this->epptr() - this->pptr());
+        this->pbump(static_cast<int>(n));
+    }
 protected:
 
     //----------grant friendship to chain_base and chainbuf-------------------//
@@ -86,6 +115,14 @@ protected:
     {
         flags_ &= ~(f_input_closed | f_output_closed);
     }
+
+    // Prepares a link which has been closed to be used again, retaining its
+    // component and buffers.
+    void rewind()
+    {
+        set_needs_close();
+        rewind_impl();
+    }
     virtual void set_next(linked_streambuf<Ch, Tr>* /* next */) { }
     virtual void close_impl(BOOST_IOS::openmode) = 0;
     virtual bool auto_close() const = 0;
@@ -93,6 +130,20 @@ protected:
     virtual bool strict_sync() = 0;
     virtual const boost::core::typeinfo& component_type() const = 0;
     virtual void* component_impl() = 0;
+    virtual void rewind_impl() { }
+    virtual std::pair<const Ch*, const Ch*>
+    peek_window_impl(std::streamsize /* n */)
+    {
+        if (this->gptr() == this->egptr())
+            this->underflow();
+        return std::pair<const Ch*, const Ch*>(this->gptr(), this->egptr());
+    }
+    virtual std::pair<Ch*, Ch*> reserve_impl(std::streamsize /* n */)
+    {
+        if (this->pptr() == this->epptr())
+            this->overflow(Tr::eof());
+        return std::pair<Ch*, Ch*>(this->pptr(), this->epptr());
+    }
 #ifndef BOOST_NO_MEMBER_TEMPLATE_FRIENDS
     private:
 #else
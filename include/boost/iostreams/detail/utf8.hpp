@@ -0,0 +1,405 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Contains routines for converting between UTF-8 and UTF-16 or UTF-32, used
+// by utf8_codecvt and by code_converter. Runs of ASCII characters are
+// converted sixteen at a time where the target supports it; see
+// <boost/iostreams/detail/config/simd.hpp>.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_UTF8_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_UTF8_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <cstddef>                              // ptrdiff_t.
+#include <boost/config.hpp>                     // BOOST_STATIC_CONSTANT.
+#include <boost/cstdint.hpp>                    // uint32_t.
+#include <boost/iostreams/detail/config/simd.hpp>
+#if defined(BOOST_IOSTREAMS_STD_UTF8_CODECVT) && \
+    !defined(BOOST_NO_CXX11_HDR_CODECVT) \
+    /**/
+# include <codecvt>                             // codecvt_utf8, etc.
+#endif
+#if defined(BOOST_IOSTREAMS_HAS_SSE2)
+# include <emmintrin.h>
+#elif defined(BOOST_IOSTREAMS_HAS_NEON)
+# include <arm_neon.h>
+#endif
+
+namespace boost { namespace iostreams { namespace detail {
+
+// Outcome of a conversion. Conversion stops at the end of the input, when
+// the input ends in the middle of a character, when there is no room in the
+// output for the next character or, unless ill-formed input is replaced by
+// U+FFFD, at the first ill-formed sequence.
+enum utf_status {
+    utf_ok,
+    utf_short_input,
+    utf_short_output,
+    utf_invalid
+};
+
+//--------------Vectorized conversion of ASCII characters---------------------//
+
+// Copies the leading ASCII characters of [from, from_end) to [to, to_end),
+// advancing both pointers.
+template<typename Ch>
+inline void widen_ascii( const char*& from, const char* from_end,
+                         Ch*& to, Ch* to_end )
+{
+#if defined(BOOST_IOSTREAMS_HAS_SSE2)
+    if (sizeof(Ch) == 2 || sizeof(Ch) == 4) {
+        const __m128i zero = _mm_setzero_si128();
+        while (from_end - from >= 16 && to_end - to >= 16) {
+            __m128i v =
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(from));
+            if (_mm_movemask_epi8(v) != 0)
+                break;
+            __m128i  lo = _mm_unpacklo_epi8(v, zero);
+            __m128i  hi = _mm_unpackhi_epi8(v, zero);
+            __m128i* out = reinterpret_cast<__m128i*>(to);
+            if (sizeof(Ch) == 2) {
+                _mm_storeu_si128(out, lo);
+                _mm_storeu_si128(out + 1, hi);
+            } else {
+                _mm_storeu_si128(out, _mm_unpacklo_epi16(lo, zero));
+                _mm_storeu_si128(out + 1, _mm_unpackhi_epi16(lo, zero));
+                _mm_storeu_si128(out + 2, _mm_unpacklo_epi16(hi, zero));
+                _mm_storeu_si128(out + 3, _mm_unpackhi_epi16(hi, zero));
+            }
+            from += 16;
+            to += 16;
+        }
+    }
+#elif defined(BOOST_IOSTREAMS_HAS_NEON)
+    if (sizeof(Ch) == 2 || sizeof(Ch) == 4) {
+        while (from_end - from >= 16 && to_end - to >= 16) {
+            uint8x16_t v =
+                vld1q_u8(reinterpret_cast<const unsigned char*>(from));
+            uint64x2_t high = vreinterpretq_u64_u8(vshrq_n_u8(v, 7));
+            if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) != 0)
+                break;
+            uint16x8_t lo = vmovl_u8(vget_low_u8(v));
+            uint16x8_t hi = vmovl_u8(vget_high_u8(v));
+            if (sizeof(Ch) == 2) {
+                uint16_t* out = reinterpret_cast<uint16_t*>(to);
+                vst1q_u16(out, lo);
+                vst1q_u16(out + 8, hi);
+            } else {
+                uint32_t* out = reinterpret_cast<uint32_t*>(to);
+                vst1q_u32(out, vmovl_u16(vget_low_u16(lo)));
+                vst1q_u32(out + 4, vmovl_u16(vget_high_u16(lo)));
+                vst1q_u32(out + 8, vmovl_u16(vget_low_u16(hi)));
+                vst1q_u32(out + 12, vmovl_u16(vget_high_u16(hi)));
+            }
+            from += 16;
+            to += 16;
+        }
+    }
+#endif
+    while ( from != from_end && to != to_end &&
+            static_cast<unsigned char>(*from) < 0x80 )
+    {
+        *to++ = static_cast<Ch>(*from++);
+    }
+}
+
+// Copies the leading ASCII characters of [from, from_end) to [to, to_end),
+// advancing both pointers.
+template<typename Ch>
+inline void narrow_ascii( const Ch*& from, const Ch* from_end,
+                          char*& to, char* to_end )
+{
+#if defined(BOOST_IOSTREAMS_HAS_SSE2)
+    if (sizeof(Ch) == 2) {
+        const __m128i mask = _mm_set1_epi16(static_cast<short>(0xFF80));
+        while (from_end - from >= 16 && to_end - to >= 16) {
+            const __m128i* in = reinterpret_cast<const __m128i*>(from);
+            __m128i a = _mm_loadu_si128(in);
+            __m128i b = _mm_loadu_si128(in + 1);
+            __m128i high = _mm_and_si128(_mm_or_si128(a, b), mask);
+            if ( _mm_movemask_epi8(
+                     _mm_cmpeq_epi16(high, _mm_setzero_si128())
+                 ) != 0xFFFF )
+            {
+                break;
+            }
+            _mm_storeu_si128( reinterpret_cast<__m128i*>(to),
+                              _mm_packus_epi16(a, b) );
+            from += 16;
+            to += 16;
+        }
+    } else if (sizeof(Ch) == 4) {
+        const __m128i mask = _mm_set1_epi32(static_cast<int>(0xFFFFFF80));
+        while (from_end - from >= 16 && to_end - to >= 16) {
+            const __m128i* in = reinterpret_cast<const __m128i*>(from);
+            __m128i a = _mm_loadu_si128(in);
+            __m128i b = _mm_loadu_si128(in + 1);
+            __m128i c = _mm_loadu_si128(in + 2);
+            __m128i d = _mm_loadu_si128(in + 3);
+            __m128i high =
+                _mm_and_si128(
+                    _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d)),
+                    mask
+                );
+            if ( _mm_movemask_epi8(
+                     _mm_cmpeq_epi32(high, _mm_setzero_si128())
+                 ) != 0xFFFF )
+            {
+                break;
+            }
+            _mm_storeu_si128(
+                reinterpret_cast<__m128i*>(to),
+                _mm_packus_epi16( _mm_packs_epi32(a, b),
+                                  _mm_packs_epi32(c, d) )
+            );
+            from += 16;
+            to += 16;
+        }
+    }
+#elif defined(BOOST_IOSTREAMS_HAS_NEON)
+    if (sizeof(Ch) == 2) {
+        while (from_end - from >= 16 && to_end - to >= 16) {
+            const uint16_t* in = reinterpret_cast<const uint16_t*>(from);
+            uint16x8_t a = vld1q_u16(in);
+            uint16x8_t b = vld1q_u16(in + 8);
+            uint64x2_t high =
+                vreinterpretq_u64_u16(vshrq_n_u16(vorrq_u16(a, b), 7));
+            if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) != 0)
+                break;
+            vst1q_u8( reinterpret_cast<unsigned char*>(to),
+                      vcombine_u8(vmovn_u16(a), vmovn_u16(b)) );
+            from += 16;
+            to += 16;
+        }
+    } else if (sizeof(Ch) == 4) {
+        while (from_end - from >= 16 && to_end - to >= 16) {
+            const uint32_t* in = reinterpret_cast<const uint32_t*>(from);
+            uint32x4_t a = vld1q_u32(in);
+            uint32x4_t b = vld1q_u32(in + 4);
+            uint32x4_t c = vld1q_u32(in + 8);
+            uint32x4_t d = vld1q_u32(in + 12);
+            uint32x4_t all = vorrq_u32(vorrq_u32(a, b), vorrq_u32(c, d));
+            uint64x2_t high = vreinterpretq_u64_u32(vshrq_n_u32(all, 7));
+            if ((vgetq_lane_u64(high, 0) | vgetq_lane_u64(high, 1)) != 0)
+                break;
+            uint16x8_t ab = vcombine_u16(vmovn_u32(a), vmovn_u32(b));
+            uint16x8_t cd = vcombine_u16(vmovn_u32(c), vmovn_u32(d));
+            vst1q_u8( reinterpret_cast<unsigned char*>(to),
+                      vcombine_u8(vmovn_u16(ab), vmovn_u16(cd)) );
+            from += 16;
+            to += 16;
+        }
+    }
+#endif
+    while ( from != from_end && to != to_end &&
+            static_cast<boost::uint32_t>(*from) < 0x80 )
+    {
+        *to++ = static_cast<char>(*from++);
+    }
+}
+
+//--------------Definition of utf8_decode and utf8_encode---------------------//
+
+// Converts UTF-8 to UTF-16, if Bits is 16, or to UTF-32, if Bits is 32,
+// advancing from and to past the converted characters. An ill-formed
+// sequence is either reported or, if replace is true, replaced by U+FFFD;
+// each maximal subpart of an ill-formed sequence produces one U+FFFD, as
+// recommended by the Unicode Standard.
+template<int Bits, typename Ch>
+utf_status utf8_decode( const char*& from, const char* from_end,
+                        Ch*& to, Ch* to_end, bool replace )
+{
+    while (from != from_end) {
+        widen_ascii(from, from_end, to, to_end);
+        if (from == from_end)
+            break;
+        if (to == to_end)
+            return utf_short_output;
+
+        // Decode one character, checking the second byte against the
+        // ranges of Table 3-7 of the Unicode Standard, which exclude
+        // overlong forms, surrogates and values above U+10FFFF.
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(from);
+        std::ptrdiff_t       avail = from_end - from;
+        boost::uint32_t      c = p[0];
+        std::ptrdiff_t       len = 0;
+        unsigned char        lo = 0x80, hi = 0xBF;
+        if (c < 0xC2) {
+            // Continuation byte or overlong two-byte form.
+        } else if (c < 0xE0) {
+            len = 2;
+            c &= 0x1F;
+        } else if (c < 0xF0) {
+            len = 3;
+            c &= 0x0F;
+            if (c == 0x0)
+                lo = 0xA0;
+            else if (c == 0xD)
+                hi = 0x9F;
+        } else if (c < 0xF5) {
+            len = 4;
+            c &= 0x07;
+            if (c == 0x0)
+                lo = 0x90;
+            else if (c == 0x4)
+                hi = 0x8F;
+        }
+        std::ptrdiff_t z = 1;
+        if (len != 0) {
+            for (; z < len && z < avail; ++z) {
+                if (p[z] < lo || p[z] > hi)
+                    break;
+                c = (c << 6) | (p[z] & 0x3F);
+                lo = 0x80;
+                hi = 0xBF;
+            }
+            if (z == len) {
+                if (Bits == 16 && c >= 0x10000) {
+                    if (to_end - to < 2)
+                        return utf_short_output;
+                    c -= 0x10000;
+                    to[0] = static_cast<Ch>(0xD800 + (c >> 10));
+                    to[1] = static_cast<Ch>(0xDC00 + (c & 0x3FF));
+                    to += 2;
+                } else {
+                    *to++ = static_cast<Ch>(c);
+                }
+                from += len;
+                continue;
+            }
+            if (z == avail)
+                return utf_short_input;
+        }
+
+        // [from, from + z) is a maximal subpart of an ill-formed sequence.
+        if (!replace)
+            return utf_invalid;
+        *to++ = static_cast<Ch>(0xFFFD);
+        from += z;
+    }
+    return utf_ok;
+}
+
+// Converts UTF-16, if Bits is 16, or UTF-32, if Bits is 32, to UTF-8,
+// advancing from and to past the converted characters. An unpaired
+// surrogate or a value above U+10FFFF is either reported or, if replace is
+// true, replaced by U+FFFD.
+template<int Bits, typename Ch>
+utf_status utf8_encode( const Ch*& from, const Ch* from_end,
+                        char*& to, char* to_end, bool replace )
+{
+    while (from != from_end) {
+        narrow_ascii(from, from_end, to, to_end);
+        if (from == from_end)
+            break;
+        boost::uint32_t  c = static_cast<boost::uint32_t>(*from);
+        std::ptrdiff_t   len = 1;
+        bool             valid;
+        if (Bits == 16 && c >= 0xD800 && c < 0xDC00) {
+            if (from_end - from < 2)
+                return utf_short_input;
+            boost::uint32_t d = static_cast<boost::uint32_t>(from[1]);
+            valid = d >= 0xDC00 && d < 0xE000;
+            if (valid) {
+                c = 0x10000 + ((c - 0xD800) << 10) + (d - 0xDC00);
+                len = 2;
+            }
+        } else {
+            valid = (c < 0xD800 || c >= 0xE000) &&
+                    c <= (Bits == 16 ? 0xFFFFu : 0x10FFFFu);
+        }
+        if (!valid) {
+            if (!replace)
+                return utf_invalid;
+            c = 0xFFFD;
+        }
+        if (c < 0x80) {
+            if (to == to_end)
+                return utf_short_output;
+            *to++ = static_cast<char>(c);
+        } else if (c < 0x800) {
+            if (to_end - to < 2)
+                return utf_short_output;
+            to[0] = static_cast<char>(0xC0 | (c >> 6));
+            to[1] = static_cast<char>(0x80 | (c & 0x3F));
+            to += 2;
+        } else if (c < 0x10000) {
+            if (to_end - to < 3)
+                return utf_short_output;
+            to[0] = static_cast<char>(0xE0 | (c >> 12));
+            to[1] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            to[2] = static_cast<char>(0x80 | (c & 0x3F));
+            to += 3;
+        } else {
+            if (to_end - to < 4)
+                return utf_short_output;
+            to[0] = static_cast<char>(0xF0 | (c >> 18));
+            to[1] = static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+            to[2] = static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+            to[3] = static_cast<char>(0x80 | (c & 0x3F));
+            to += 4;
+        }
+        from += len;
+    }
+    return utf_ok;
+}
+
+//--------------Definition of utf8_conversion---------------------------------//
+
+// Identifies the codecvt facets which convert between UTF-8 and UTF-16 or
+// UTF-32, for which code_converter calls utf8_decode and utf8_encode
+// directly. The member bits is 16 or 32, or 0 for other facets. The facets
+// of <codecvt>, which is deprecated, are recognized only if
+// BOOST_IOSTREAMS_STD_UTF8_CODECVT is defined, so that <codecvt> is not
+// otherwise included.
+template<int Bits, bool Replace = false>
+struct utf8_conversion_impl {
+    BOOST_STATIC_CONSTANT(int, bits = Bits);
+    BOOST_STATIC_CONSTANT(bool, replace = Replace);
+};
+
+template<typename Codecvt>
+struct utf8_conversion : utf8_conversion_impl<0> { };
+
+#if defined(BOOST_IOSTREAMS_STD_UTF8_CODECVT) && \
+    !defined(BOOST_NO_CXX11_HDR_CODECVT) \
+    /**/
+template<>
+struct utf8_conversion< std::codecvt_utf8<wchar_t> >
+    : utf8_conversion_impl<sizeof(wchar_t) == 4 ? 32 : 0>
+    { };
+
+template<>
+struct utf8_conversion< std::codecvt_utf8_utf16<wchar_t> >
+    : utf8_conversion_impl<16>
+    { };
+
+# if !defined(BOOST_NO_CXX11_CHAR16_T)
+template<>
+struct utf8_conversion< std::codecvt_utf8_utf16<char16_t> >
+    : utf8_conversion_impl<16>
+    { };
+# endif
+
+# if !defined(BOOST_NO_CXX11_CHAR32_T)
+template<>
+struct utf8_conversion< std::codecvt_utf8<char32_t> >
+    : utf8_conversion_impl<32>
+    { };
+
+template<>
+struct utf8_conversion< std::codecvt_utf8_utf16<char32_t> >
+    : utf8_conversion_impl<16>
+    { };
+# endif
+#endif // #if defined(BOOST_IOSTREAMS_STD_UTF8_CODECVT) && ...
+
+} } } // End namespaces detail, iostreams, boost.
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_UTF8_HPP_INCLUDED
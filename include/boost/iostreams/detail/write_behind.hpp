@@ -0,0 +1,221 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Contains the definition of the class template write_behind, the engine
+// shared by async_sink and threaded_filter. Requires C++11 threading support.
+
+#ifndef BOOST_IOSTREAMS_DETAIL_WRITE_BEHIND_HPP_INCLUDED
+#define BOOST_IOSTREAMS_DETAIL_WRITE_BEHIND_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <atomic>
+#include <cstddef>                               // size_t.
+#include <exception>                             // exception_ptr.
+#include <stdexcept>                             // invalid_argument.
+#include <thread>
+#include <boost/iostreams/detail/ios.hpp>        // streamsize.
+#include <boost/iostreams/detail/spsc_ring.hpp>
+#include <boost/throw_exception.hpp>
+
+namespace boost { namespace iostreams { namespace detail {
+
+//
+// Template name: write_behind.
+// Template parameters:
+//      Ch - The character type.
+// Description: Passes the characters written by one thread through a
+//      bounded ring to a worker thread, which hands them to a function object
+//      supplied to start(). The writing thread blocks only while the ring is
+//      full. An exception thrown on the worker thread stops it and is
+//      rethrown on the writing thread by the next call to write(), drain()
+//      or close(). While the function object accepts no characters, as when
+//      it writes to a non-blocking Sink, the worker yields before retrying;
+//      characters still pending when the write_behind is destroyed are
+//      discarded once they cannot be written.
+//
+template<typename Ch>
+class write_behind {
+public:
+    explicit write_behind(std::streamsize ring_size)
+        : ring_(checked_size(ring_size)),
+          produced_(0), processed_(0), stop_(false), failed_(false)
+        { }
+    ~write_behind()
+    {
+        if (worker_.joinable()) {
+            stop_.store(true);
+            ring_.notify();
+            worker_.join();
+        }
+    }
+    bool started() const { return worker_.joinable(); }
+
+    // Starts the worker thread, which passes characters to op, a function
+    // object with the signature std::streamsize(const Ch*, std::streamsize)
+    // returning the number of characters accepted.
+    template<typename Op>
+    void start(const Op& op)
+    {
+        stop_.store(false);
+        produced_ = 0;
+        processed_.store(0);
+        worker_ = std::thread(worker<Op>(*this, op));
+    }
+
+    // Copies the given characters into the ring, waiting while it is full.
+    void write(const Ch* s, std::streamsize n)
+    {
+        std::size_t result = 0, amt = static_cast<std::size_t>(n);
+        while (result < amt) {
+            check();
+            std::size_t count = ring_.write(s + result, amt - result);
+            if (count == 0)
+                ring_.wait(writable_or_failed(*this));
+            result += count;
+        }
+        produced_ += amt;
+    }
+
+    // Waits until the worker has processed all characters written so far.
+    void drain()
+    {
+        if (!worker_.joinable())
+            return;
+        ring_.wait(drained_or_failed(*this, produced_));
+        check();
+    }
+
+    // Drains and stops the worker, then calls closer(). If the worker has
+    // failed, closer() is still called, and the worker's exception is
+    // rethrown in place of any it throws.
+    template<typename Closer>
+    void close(const Closer& closer)
+    {
+        try {
+            drain();
+        } catch (...) {
+            stop();
+            error_ = std::exception_ptr();
+            failed_.store(false);
+            try {
+                closer();
+            } catch (...) { }
+            throw;
+        }
+        stop();
+        closer();
+    }
+private:
+    write_behind(const write_behind&);
+    write_behind& operator=(const write_behind&);
+
+    static std::size_t checked_size(std::streamsize ring_size)
+    {
+        if (ring_size <= 0)
+            boost::throw_exception(std::invalid_argument("bad ring size"));
+        return static_cast<std::size_t>(ring_size);
+    }
+
+    void check()
+    {
+        if (failed_.load(std::memory_order_acquire))
+            std::rethrow_exception(error_);
+    }
+
+    void stop()
+    {
+        if (!worker_.joinable())
+            return;
+        stop_.store(true);
+        ring_.notify();
+        worker_.join();
+        std::size_t n;
+        const Ch* p;
+        while ((n = ring_.readable(p)) != 0)  // Left by a failed worker.
+            ring_.consume(n);
+    }
+
+    struct writable_or_failed {
+        explicit writable_or_failed(write_behind& w) : w_(w) { }
+        bool operator()() const
+        {
+            return w_.ring_.size() < w_.ring_.capacity() ||
+                   w_.failed_.load();
+        }
+        write_behind& w_;
+    };
+    struct drained_or_failed {
+        drained_or_failed(write_behind& w, std::size_t target)
+            : w_(w), target_(target)
+            { }
+        bool operator()() const
+        { return w_.processed_.load() == target_ || w_.failed_.load(); }
+        write_behind&  w_;
+        std::size_t    target_;
+    };
+    struct readable_or_stopped {
+        explicit readable_or_stopped(write_behind& w) : w_(w) { }
+        bool operator()() const
+        { return !w_.ring_.empty() || w_.stop_.load(); }
+        write_behind& w_;
+    };
+
+    template<typename Op>
+    struct worker {
+        worker(write_behind& w, const Op& op) : w_(w), op_(op) { }
+        void operator()()
+        {
+            write_behind& w = w_;
+            try {
+                for (;;) {
+                    const Ch* p;
+                    std::size_t n = w.ring_.readable(p);
+                    if (n == 0) {
+                        if (w.stop_.load())
+                            return;
+                        w.ring_.wait(readable_or_stopped(w));
+                        continue;
+                    }
+                    std::streamsize amt =
+                        op_(p, static_cast<std::streamsize>(n));
+                    if (amt <= 0) {
+
+                        // The Sink would block; the destructor abandons
+                        // characters which cannot be written.
+                        if (w.stop_.load())
+                            return;
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    w.ring_.consume(static_cast<std::size_t>(amt));
+                    w.processed_.fetch_add(static_cast<std::size_t>(amt));
+                    w.ring_.notify();
+                }
+            } catch (...) {
+                w.error_ = std::current_exception();
+                w.failed_.store(true);
+                w.ring_.notify();
+            }
+        }
+        write_behind&  w_;
+        Op             op_;
+    };
+
+    spsc_ring<Ch>             ring_;
+    std::thread               worker_;
+    std::size_t               produced_;  // Writing thread only.
+    std::atomic<std::size_t>  processed_;
+    std::atomic<bool>         stop_;
+    std::atomic<bool>         failed_;
+    std::exception_ptr        error_;
+};
+
+} } } // End namespaces detail, iostreams, boost.
+
+#endif // #ifndef BOOST_IOSTREAMS_DETAIL_WRITE_BEHIND_HPP_INCLUDED
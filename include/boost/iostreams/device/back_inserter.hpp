@@ -12,20 +12,109 @@
 # pragma once
 #endif
 
+#include <algorithm>                      // max, min.
+#include <cstddef>                        // size_t.
+#include <string>
+#include <utility>                        // pair.
+#include <vector>
 #include <boost/iostreams/detail/ios.hpp> // streamsize.
 #include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/constants.hpp>  // default_device_buffer_size.
+#include <boost/mpl/bool.hpp>
+#include <boost/static_assert.hpp>
 
 namespace boost { namespace iostreams {
 
+namespace detail {
+
+// Indicates whether Container stores its elements in an array and provides
+// reserve() and capacity().
+template<typename Container>
+struct is_contiguous_container : mpl::false_ { };
+
+template<typename T, typename Alloc>
+struct is_contiguous_container< std::vector<T, Alloc> > : mpl::true_ { };
+
+template<typename Alloc>
+struct is_contiguous_container< std::vector<bool, Alloc> > : mpl::false_ { };
+
+template<typename Ch, typename Tr, typename Alloc>
+struct is_contiguous_container< std::basic_string<Ch, Tr, Alloc> >
+    : mpl::true_
+    { };
+
+// Ensures that at least n elements can be appended to the given container
+// without reallocation, at least doubling its capacity if it must grow, so
+// that the cost of appending is amortized constant independently of the
+// container's own growth policy.
+template<typename Container>
+void reserve_for_append(Container& cnt, std::size_t n, mpl::true_)
+{
+    std::size_t size = cnt.size(), capacity = cnt.capacity();
+    if (capacity - size < n)
+        cnt.reserve((std::max)(size + n, 2 * capacity));
+}
+
+template<typename Container>
+void reserve_for_append(Container&, std::size_t, mpl::false_) { }
+
+// Reserves storage for n elements beyond the current size of the given
+// container.
+template<typename Container>
+void reserve_expected(Container& cnt, std::size_t n, mpl::true_)
+{ if (n) cnt.reserve(cnt.size() + n); }
+
+template<typename Container>
+void reserve_expected(Container&, std::size_t, mpl::false_) { }
+
+// Appends n elements to the given container. The elements of a
+// std::basic_string are left uninitialized where the standard library
+// permits it, since they are about to be overwritten.
+template<typename Container>
+void extend(Container& cnt, std::size_t n) { cnt.resize(cnt.size() + n); }
+
+#if defined(__cpp_lib_string_resize_and_overwrite)
+template<typename Ch, typename Tr, typename Alloc>
+void extend(std::basic_string<Ch, Tr, Alloc>& s, std::size_t n)
+{
+    s.resize_and_overwrite(
+        s.size() + n,
+        [](Ch*, std::size_t size) { return size; }
+    );
+}
+#endif
+
+} // End namespace detail.
+
+//
+// Template name: back_insert_device.
+// Description: Sink which appends to a standard library sequence container.
+//      If the container is a std::vector or std::basic_string, storage is
+//      reserved for the expected size, if one is given, and otherwise grows
+//      geometrically.
+// Template parameters:
+//      Container - A standard library sequence container.
+//
 template<typename Container>
 class back_insert_device {
 public:
     typedef typename Container::value_type  char_type;
     typedef sink_tag                        category;
     back_insert_device(Container& cnt) : container(&cnt) { }
+    back_insert_device(Container& cnt, std::size_t expected_size)
+        : container(&cnt)
+    {
+        detail::reserve_expected(
+            cnt, expected_size, detail::is_contiguous_container<Container>()
+        );
+    }
     std::streamsize write(const char_type* s, std::streamsize n)
-    { 
-        container->insert(container->end(), s, s + n); 
+    {
+        detail::reserve_for_append(
+            *container, static_cast<std::size_t>(n),
+            detail::is_contiguous_container<Container>()
+        );
+        container->insert(container->end(), s, s + n);
         return n;
     }
 protected:
@@ -36,6 +125,96 @@ template<typename Container>
 back_insert_device<Container> back_inserter(Container& cnt)
 { return back_insert_device<Container>(cnt); }
 
+template<typename Container>
+back_insert_device<Container>
+back_inserter(Container& cnt, std::size_t expected_size)
+{ return back_insert_device<Container>(cnt, expected_size); }
+
+//
+// Template name: direct_back_insert_device.
+// Description: Sink which appends to a std::vector or std::basic_string.
+//      When used with stream or stream_buffer, characters are written
+//      directly into the container's unused capacity, which is enlarged
+//      geometrically as it fills up; the container is shrunk to the size
+//      of the data written when the device is closed. Until then, the
+//      container's size may include part of its unused capacity. Other
+//      components, such as copy(), use the member function write(), which
+//      appends as back_insert_device does.
+// Template parameters:
+//      Container - A std::vector or std::basic_string.
+//
+template<typename Container>
+class direct_back_insert_device {
+public:
+    typedef typename Container::value_type     char_type;
+    typedef std::pair<char_type*, char_type*>  pair_type;
+    struct category
+        : sink_tag,
+          detail::growable_tag
+        { };
+    explicit direct_back_insert_device( Container& cnt,
+                                        std::size_t expected_size = 0 )
+        : container_(&cnt), size_(cnt.size())
+    {
+        BOOST_STATIC_ASSERT(detail::is_contiguous_container<Container>::value);
+        detail::reserve_expected(cnt, expected_size, mpl::true_());
+    }
+    std::streamsize write(const char_type* s, std::streamsize n)
+    {
+        container_->resize(size_);
+        detail::reserve_for_append(
+            *container_, static_cast<std::size_t>(n), mpl::true_()
+        );
+        container_->insert(container_->end(), s, s + n);
+        size_ = container_->size();
+        return n;
+    }
+
+    // Returns an output sequence beginning at the end of the data written
+    // so far.
+    pair_type output_sequence() { return grow_output_sequence(0); }
+
+    // Returns a longer output sequence whose first used characters are those
+    // of the current one. The sequence is extended by at most window
+    // characters at a time, so that the value-initialization performed by
+    // resize() touches memory shortly before it is overwritten; when the
+    // container's capacity is exhausted, it is at least doubled.
+    pair_type grow_output_sequence(std::streamsize used)
+    {
+        std::size_t size = size_ + static_cast<std::size_t>(used);
+        container_->resize(size);
+        if (size == container_->capacity())
+            detail::reserve_for_append(
+                *container_,
+                static_cast<std::size_t>(default_device_buffer_size),
+                mpl::true_()
+            );
+        detail::extend(
+            *container_,
+            (std::min)( container_->capacity() - size,
+                        static_cast<std::size_t>(window) )
+        );
+        char_type* first = &(*container_)[0];
+        return pair_type(first + size_, first + container_->size());
+    }
+
+    // Shrinks the container to the size of the data written.
+    void shrink_output_sequence(std::streamsize used)
+    {
+        size_ += static_cast<std::size_t>(used);
+        container_->resize(size_);
+    }
+private:
+    BOOST_STATIC_CONSTANT(std::size_t, window = 64 * 1024);
+    Container*   container_;
+    std::size_t  size_;
+};
+
+template<typename Container>
+direct_back_insert_device<Container>
+direct_back_inserter(Container& cnt, std::size_t expected_size = 0)
+{ return direct_back_insert_device<Container>(cnt, expected_size); }
+
 } } // End namespaces iostreams, boost.
 
 #endif // #ifndef BOOST_IOSTREAMS_BACK_INSERTER_HPP_INCLUDED
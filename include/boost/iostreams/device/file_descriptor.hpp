@@ -37,6 +37,7 @@
 namespace boost { namespace iostreams {
 
 // Forward declarations
+class file_descriptor;
 class file_descriptor_source;
 class file_descriptor_sink;
 namespace detail { struct file_descriptor_impl; }
@@ -47,6 +48,38 @@ enum file_descriptor_flags
     close_handle = 3
 };
 
+// Interface of objects which synchronize files on behalf of file_descriptors,
+// for example by batching the synchronization of many files; see
+// <boost/iostreams/device/group_commit.hpp>.
+class file_sync_group {
+public:
+    // Returns once the data written to fd before the call have been
+    // transferred to storage, normally by calling fd.sync().
+    virtual void commit(file_descriptor& fd) = 0;
+protected:
+    virtual ~file_sync_group() { }
+};
+
+// Determines when the data written to a file_descriptor are transferred to
+// storage.
+struct file_sync_policy {
+    enum mode_type {
+        none,       // Never; commit() does nothing.
+        periodic,   // Every bytes characters or milliseconds, and on close.
+        on_commit   // On each call to commit().
+    };
+    explicit file_sync_policy( mode_type m = none,
+                               boost::intmax_t n = 0,
+                               long ms = 0,
+                               file_sync_group* g = 0 )
+        : mode(m), bytes(n), milliseconds(ms), group(g)
+        { }
+    mode_type         mode;
+    boost::intmax_t   bytes;
+    long              milliseconds;
+    file_sync_group*  group;  // If non-null, performs the synchronization.
+};
+
 class BOOST_IOSTREAMS_DECL file_descriptor {
 public:
     friend class file_descriptor_source;
@@ -135,6 +168,12 @@ public:
     std::streamsize write(const char_type* s, std::streamsize n);
     std::streampos seek(stream_offset off, BOOST_IOS::seekdir way);
     handle_type handle() const;
+
+    // Durability
+    void set_sync_policy(const file_sync_policy& policy);
+    file_sync_policy sync_policy() const;
+    void sync();
+    void commit();
 private:
     void init();
 
@@ -247,6 +286,10 @@ public:
     using file_descriptor::write;
     using file_descriptor::seek;
     using file_descriptor::handle;
+    using file_descriptor::set_sync_policy;
+    using file_descriptor::sync_policy;
+    using file_descriptor::sync;
+    using file_descriptor::commit;
 
     // Default constructor
     file_descriptor_sink() { }
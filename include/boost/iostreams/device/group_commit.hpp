@@ -0,0 +1,173 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class group_commit, a file_sync_group which batches the
+// synchronization of files written by many threads. Requires C++11 threading
+// support.
+
+#ifndef BOOST_IOSTREAMS_GROUP_COMMIT_HPP_INCLUDED
+#define BOOST_IOSTREAMS_GROUP_COMMIT_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>                      // BOOST_NO_CXX11_XXX.
+
+#if defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE) || \
+    defined(BOOST_NO_CXX11_HDR_MUTEX) || \
+    defined(BOOST_NO_CXX11_HDR_THREAD)
+# error "Boost.Iostreams: threaded components require C++11 threading support"
+#endif
+
+#include <condition_variable>
+#include <cstddef>                               // size_t.
+#include <exception>                             // exception_ptr.
+#include <memory>                                // shared_ptr.
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <boost/iostreams/device/file_descriptor.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+//
+// Class name: group_commit.
+// Description: file_sync_group which lets concurrent commits share the
+//      synchronization of their files. The first thread to commit becomes the
+//      leader of a batch and synchronizes the distinct files in it
+//      concurrently, so that a batch takes about as long as its slowest file;
+//      threads which commit while the leader is busy join the next batch,
+//      whose members are released together once one of them, as leader, has
+//      synchronized the files. An exception thrown while synchronizing a file
+//      is rethrown to the threads which committed that file.
+//
+class group_commit : public file_sync_group {
+public:
+    group_commit() : open_(new batch), syncing_(false), batches_(0) { }
+
+    void commit(file_descriptor& fd)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        std::shared_ptr<batch> b = open_;
+        std::size_t slot = b->add(fd);
+        while (!b->done) {
+            if (!syncing_) {
+                // b is the open batch: lead it.
+                syncing_ = true;
+                open_.reset(new batch);
+                lock.unlock();
+                b->run(*this);
+                lock.lock();
+                b->done = true;
+                syncing_ = false;
+                ++batches_;
+                cond_.notify_all();
+            } else {
+                cond_.wait(lock);
+            }
+        }
+        if (b->errors[slot])
+            std::rethrow_exception(b->errors[slot]);
+    }
+
+    // Returns the number of batches synchronized so far.
+    std::size_t batches() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return batches_;
+    }
+
+    // Returns the number of commits waiting for the next batch to start.
+    std::size_t pending() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return open_->commits;
+    }
+protected:
+    // Synchronizes fd. Called by the leader of a batch, concurrently for
+    // the distinct files in the batch.
+    virtual void sync(file_descriptor& fd) { fd.sync(); }
+private:
+    typedef file_descriptor::handle_type handle_type;
+    struct batch {
+        batch() : commits(0), done(false) { }
+
+        // Adds fd to the batch, unless a file with the same handle has
+        // already been added, and returns its index.
+        std::size_t add(file_descriptor& fd)
+        {
+            ++commits;
+            handle_type h = fd.handle();
+            for (std::size_t z = 0, n = files.size(); z < n; ++z)
+                if (handles[z] == h)
+                    return z;
+            files.push_back(&fd);
+            handles.push_back(h);
+            errors.push_back(std::exception_ptr());
+            return files.size() - 1;
+        }
+
+        // Synchronizes the first file on the calling thread and each of
+        // the others on a thread of its own, or on the calling thread if no
+        // thread can be started.
+        void run(group_commit& g)
+        {
+            std::vector<std::thread> helpers;
+            for (std::size_t z = 1, n = files.size(); z < n; ++z) {
+                try {
+                    helpers.push_back(std::thread(syncer(g, *this, z)));
+                } catch (...) {
+                    syncer(g, *this, z)();
+                }
+            }
+            if (!files.empty())
+                syncer(g, *this, 0)();
+            for (std::size_t z = 0, n = helpers.size(); z < n; ++z)
+                helpers[z].join();
+        }
+
+        // The file_descriptors are owned by threads waiting for the batch.
+        std::vector<file_descriptor*>     files;
+        std::vector<handle_type>          handles;
+        std::vector<std::exception_ptr>   errors;
+        std::size_t                       commits;
+        bool                              done;
+    };
+
+    // Synchronizes the i-th file of a batch, recording any exception.
+    struct syncer {
+        syncer(group_commit& g, batch& b, std::size_t i)
+            : group_(g), batch_(b), index_(i)
+            { }
+        void operator()() const
+        {
+            try {
+                group_.sync(*batch_.files[index_]);
+            } catch (...) {
+                batch_.errors[index_] = std::current_exception();
+            }
+        }
+        group_commit&  group_;
+        batch&         batch_;
+        std::size_t    index_;
+    };
+
+    mutable std::mutex       mutex_;
+    std::condition_variable  cond_;
+    std::shared_ptr<batch>   open_;      // Batch accepting commits.
+    bool                     syncing_;   // True while a leader is syncing.
+    std::size_t              batches_;
+};
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
+
+#endif // #ifndef BOOST_IOSTREAMS_GROUP_COMMIT_HPP_INCLUDED
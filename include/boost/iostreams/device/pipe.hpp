@@ -0,0 +1,241 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class templates basic_pipe_sink and basic_pipe_source and the
+// functions make_pipe and make_wpipe, which connect a Sink written by one
+// thread to a Source read by another. Requires C++11 threading support.
+
+#ifndef BOOST_IOSTREAMS_PIPE_HPP_INCLUDED
+#define BOOST_IOSTREAMS_PIPE_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <atomic>
+#include <cstddef>                               // size_t.
+#include <utility>                               // pair.
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/detail/config/wide_streams.hpp>
+#include <boost/iostreams/detail/ios.hpp>        // failure, streamsize.
+#include <boost/iostreams/detail/spsc_ring.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/throw_exception.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+// Flags passed to make_pipe. An end which does not block returns fewer
+// characters than requested, possibly none, instead of waiting.
+enum pipe_flags {
+    pipe_blocking = 0,
+    pipe_non_blocking_read = 1,
+    pipe_non_blocking_write = 2,
+    pipe_non_blocking = pipe_non_blocking_read | pipe_non_blocking_write
+};
+
+// The default capacity of a pipe, in characters.
+const std::size_t default_pipe_capacity = 64 * 1024;
+
+template<typename Ch> class basic_pipe_sink;
+template<typename Ch> class basic_pipe_source;
+
+template<typename Ch>
+std::pair< basic_pipe_sink<Ch>, basic_pipe_source<Ch> >
+make_basic_pipe( std::size_t capacity = default_pipe_capacity,
+                 int flags = pipe_blocking );
+
+namespace detail {
+
+template<typename Ch>
+struct pipe_impl {
+    pipe_impl(std::size_t capacity, int flags)
+        : ring_(capacity), flags_(flags),
+          writer_closed_(false), reader_closed_(false)
+        { }
+    spsc_ring<Ch>      ring_;
+    int                flags_;
+    std::atomic<bool>  writer_closed_;
+    std::atomic<bool>  reader_closed_;
+};
+
+//
+// Template name: pipe_end.
+// Description: State of one end of a pipe, shared by copies of a pipe_sink
+//      or pipe_source. The end is closed by close() or by the destruction of
+//      the last copy, so that the other end observes the end of the stream,
+//      or a broken pipe, even if the owner of an end exits by an exception.
+//
+template<typename Ch>
+class pipe_end {
+public:
+    pipe_end(const shared_ptr< pipe_impl<Ch> >& pipe, bool writer)
+        : pipe_(pipe), writer_(writer)
+        { }
+    ~pipe_end() { close(); }
+    pipe_impl<Ch>& pipe() { return *pipe_; }
+    void close()
+    {
+        std::atomic<bool>& closed =
+            writer_ ? pipe_->writer_closed_ : pipe_->reader_closed_;
+        if (!closed.exchange(true))
+            pipe_->ring_.notify();
+    }
+private:
+    pipe_end(const pipe_end&);
+    pipe_end& operator=(const pipe_end&);
+    shared_ptr< pipe_impl<Ch> >  pipe_;
+    bool                         writer_;
+};
+
+} // End namespace detail.
+
+//
+// Template name: basic_pipe_sink.
+// Template parameters:
+//      Ch - The character type.
+// Description: Sink which writes to the ring of a pipe created by make_pipe,
+//      from which characters are read by the connected basic_pipe_source,
+//      usually on another thread. In blocking mode, write() waits while the
+//      ring is full; otherwise it returns the number of characters which fit.
+//      Writing throws once the reader has closed its end. Closing marks the
+//      end of the stream for the reader. Copies share their state.
+//
+template<typename Ch>
+class basic_pipe_sink {
+public:
+    typedef Ch char_type;
+    struct category
+        : sink_tag,
+          closable_tag
+        { };
+    std::streamsize write(const char_type* s, std::streamsize n)
+    {
+        detail::pipe_impl<Ch>& p = end_->pipe();
+        std::size_t result = 0, amt = static_cast<std::size_t>(n);
+        while (result < amt) {
+            if (p.reader_closed_.load())
+                boost::throw_exception(BOOST_IOSTREAMS_FAILURE("broken pipe"));
+            std::size_t count = p.ring_.write(s + result, amt - result);
+            result += count;
+            if (count == 0) {
+                if ((p.flags_ & pipe_non_blocking_write) != 0)
+                    break;
+                p.ring_.wait(writable_or_closed(p));
+            }
+        }
+        return static_cast<std::streamsize>(result);
+    }
+    void close() { end_->close(); }
+    std::size_t capacity() const { return end_->pipe().ring_.capacity(); }
+private:
+    friend std::pair< basic_pipe_sink<Ch>, basic_pipe_source<Ch> >
+    make_basic_pipe<Ch>(std::size_t, int);
+    explicit basic_pipe_sink(const shared_ptr< detail::pipe_impl<Ch> >& p)
+        : end_(new detail::pipe_end<Ch>(p, true))
+        { }
+    struct writable_or_closed {
+        explicit writable_or_closed(detail::pipe_impl<Ch>& p) : pipe_(p) { }
+        bool operator()() const
+        {
+            return pipe_.ring_.size() < pipe_.ring_.capacity() ||
+                   pipe_.reader_closed_.load();
+        }
+        detail::pipe_impl<Ch>& pipe_;
+    };
+    shared_ptr< detail::pipe_end<Ch> > end_;
+};
+
+//
+// Template name: basic_pipe_source.
+// Template parameters:
+//      Ch - The character type.
+// Description: Source which reads the characters written to the connected
+//      basic_pipe_sink. In blocking mode, read() waits until at least one
+//      character is available; otherwise it returns 0 if none is. read()
+//      returns -1 once the writer has closed its end and all characters have
+//      been read. Closing causes subsequent writes to throw. Copies share
+//      their state.
+//
+template<typename Ch>
+class basic_pipe_source {
+public:
+    typedef Ch char_type;
+    struct category
+        : source_tag,
+          closable_tag
+        { };
+    std::streamsize read(char_type* s, std::streamsize n)
+    {
+        detail::pipe_impl<Ch>& p = end_->pipe();
+        std::size_t amt = static_cast<std::size_t>(n);
+        for (;;) {
+            std::size_t result = p.ring_.read(s, amt);
+            if (result != 0 || amt == 0)
+                return static_cast<std::streamsize>(result);
+            if (p.writer_closed_.load()) {
+
+                // Characters may have been written just before closing
+                result = p.ring_.read(s, amt);
+                return result != 0 ? static_cast<std::streamsize>(result) : -1;
+            }
+            if ((p.flags_ & pipe_non_blocking_read) != 0)
+                return 0;
+            p.ring_.wait(readable_or_closed(p));
+        }
+    }
+    void close() { end_->close(); }
+    std::size_t capacity() const { return end_->pipe().ring_.capacity(); }
+private:
+    friend std::pair< basic_pipe_sink<Ch>, basic_pipe_source<Ch> >
+    make_basic_pipe<Ch>(std::size_t, int);
+    explicit basic_pipe_source(const shared_ptr< detail::pipe_impl<Ch> >& p)
+        : end_(new detail::pipe_end<Ch>(p, false))
+        { }
+    struct readable_or_closed {
+        explicit readable_or_closed(detail::pipe_impl<Ch>& p) : pipe_(p) { }
+        bool operator()() const
+        { return !pipe_.ring_.empty() || pipe_.writer_closed_.load(); }
+        detail::pipe_impl<Ch>& pipe_;
+    };
+    shared_ptr< detail::pipe_end<Ch> > end_;
+};
+
+typedef basic_pipe_sink<char>        pipe_sink;
+typedef basic_pipe_source<char>      pipe_source;
+typedef basic_pipe_sink<wchar_t>     wpipe_sink;
+typedef basic_pipe_source<wchar_t>   wpipe_source;
+
+// Returns a connected sink and source sharing a ring of the given capacity,
+// rounded up to a power of two. flags is a combination of pipe_flags.
+template<typename Ch>
+std::pair< basic_pipe_sink<Ch>, basic_pipe_source<Ch> >
+make_basic_pipe(std::size_t capacity, int flags)
+{
+    shared_ptr< detail::pipe_impl<Ch> >
+        p(new detail::pipe_impl<Ch>(capacity, flags));
+    return std::make_pair(basic_pipe_sink<Ch>(p), basic_pipe_source<Ch>(p));
+}
+
+inline std::pair<pipe_sink, pipe_source>
+make_pipe( std::size_t capacity = default_pipe_capacity,
+           int flags = pipe_blocking )
+{ return make_basic_pipe<char>(capacity, flags); }
+
+#ifndef BOOST_IOSTREAMS_NO_WIDE_STREAMS
+inline std::pair<wpipe_sink, wpipe_source>
+make_wpipe( std::size_t capacity = default_pipe_capacity,
+            int flags = pipe_blocking )
+{ return make_basic_pipe<wchar_t>(capacity, flags); }
+#endif
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>  // MSVC.
+
+#endif // #ifndef BOOST_IOSTREAMS_PIPE_HPP_INCLUDED
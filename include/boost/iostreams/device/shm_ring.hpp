@@ -0,0 +1,458 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the classes shm_ring_sink and shm_ring_source, which pass a stream
+// of characters from one process to another through a ring buffer in a
+// memory-mapped file. Requires C++11 <atomic>, <chrono> and <thread>.
+
+#ifndef BOOST_IOSTREAMS_SHM_RING_HPP_INCLUDED
+#define BOOST_IOSTREAMS_SHM_RING_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>
+
+#if defined(BOOST_NO_CXX11_HDR_ATOMIC) || \
+    defined(BOOST_NO_CXX11_HDR_THREAD) || \
+    defined(BOOST_NO_CXX11_HDR_CHRONO)
+# error "Boost.Iostreams: threaded components require C++11 threading support"
+#endif
+
+#include <algorithm>                              // min.
+#include <atomic>
+#include <chrono>
+#include <cstddef>                                // size_t.
+#include <cstring>                                // memcpy.
+#include <new>                                    // placement new.
+#include <string>
+#include <thread>                                 // yield, sleep_for.
+#include <utility>                                // pair.
+#include <boost/cstdint.hpp>
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/detail/config/windows_posix.hpp>
+#include <boost/iostreams/detail/ios.hpp>         // failure, streamsize.
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
+
+#if defined(__linux__)
+# include <climits>                               // INT_MAX.
+# include <ctime>                                 // timespec.
+# include <linux/futex.h>
+# include <sys/syscall.h>
+# include <unistd.h>
+#endif
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+namespace detail {
+
+// The counters and flags shared by the two processes are 32-bit atomics,
+// which are lock-free, and therefore address-free, on all supported
+// platforms, and which can serve as futex words on Linux.
+BOOST_STATIC_ASSERT(ATOMIC_INT_LOCK_FREE == 2);
+typedef std::atomic<boost::uint32_t> shm_ring_word;
+
+//
+// Class name: shm_ring_header.
+// Description: Layout of the beginning of the mapped file. The counters head
+//      and tail run freely, so that head - tail is the number of characters
+//      in the ring. A process waiting for data or space registers in
+//      reader_waiting or writer_waiting and sleeps until data_event or
+//      space_event changes; the other process increments the event and wakes
+//      it only if it has registered.
+//
+struct shm_ring_header {
+    enum {
+        magic_value = 0x52495053,  // "SPIR" in little-endian order.
+        writer_closed = 1,
+        reader_closed = 2,
+        size = 256                 // Offset of the characters in the file.
+    };
+    shm_ring_word    magic;
+    boost::uint32_t  capacity;
+    char             pad0_[56];
+    shm_ring_word    head;         // Characters written.
+    char             pad1_[60];
+    shm_ring_word    tail;         // Characters read.
+    char             pad2_[60];
+    shm_ring_word    data_event;
+    shm_ring_word    space_event;
+    shm_ring_word    reader_waiting;
+    shm_ring_word    writer_waiting;
+    shm_ring_word    closed;
+};
+
+BOOST_STATIC_ASSERT(sizeof(shm_ring_header) <= shm_ring_header::size);
+
+// Blocks until the value of word is no longer value, or until a spurious
+// wakeup. On Linux, this is a futex wait, valid across processes; elsewhere,
+// the calling thread sleeps briefly.
+inline void shm_ring_wait(shm_ring_word& word, boost::uint32_t value)
+{
+#if defined(__linux__)
+    // The timeout is a safeguard only; every change is followed by a wakeup.
+    struct timespec timeout = { 0, 100 * 1000 * 1000 };
+    ::syscall( SYS_futex, reinterpret_cast<boost::uint32_t*>(&word),
+               FUTEX_WAIT, value, &timeout, 0, 0 );
+#else
+    if (word.load() == value)
+        std::this_thread::sleep_for(std::chrono::microseconds(200));
+#endif
+}
+
+// Wakes the threads blocked in shm_ring_wait() on word.
+inline void shm_ring_wake(shm_ring_word& word)
+{
+#if defined(__linux__)
+    ::syscall( SYS_futex, reinterpret_cast<boost::uint32_t*>(&word),
+               FUTEX_WAKE, INT_MAX, 0, 0, 0 );
+#else
+    (void) word;
+#endif
+}
+
+//
+// Class name: shm_ring_impl.
+// Description: One end of a ring; the writer end creates the file and
+//      initializes the header, and the reader end maps an existing file.
+//      Closing an end, explicitly or by destruction, is visible to the other.
+//
+class shm_ring_impl {
+public:
+    enum { spin_count = 64 };
+    enum role { writer, reader };
+
+    // Creates a ring.
+    shm_ring_impl(const std::string& path, std::size_t capacity)
+        : role_(writer), closed_(false)
+    {
+        if (capacity == 0 || capacity > (std::size_t(1) << 30))
+            boost::throw_exception(
+                BOOST_IOSTREAMS_FAILURE("bad shared-memory ring capacity")
+            );
+        std::size_t size = 1;
+        while (size < capacity)
+            size <<= 1;
+        mapped_file_params p(path);
+        p.flags = mapped_file::readwrite;
+        p.new_file_size = shm_ring_header::size + size;
+        file_.open(p);
+        header_ = new (file_.data()) shm_ring_header;
+        header_->capacity = static_cast<boost::uint32_t>(size);
+        header_->head.store(0);
+        header_->tail.store(0);
+        header_->data_event.store(0);
+        header_->space_event.store(0);
+        header_->reader_waiting.store(0);
+        header_->writer_waiting.store(0);
+        header_->closed.store(0);
+        header_->magic.store(shm_ring_header::magic_value);
+        init();
+    }
+
+    // Opens a ring created by another process.
+    explicit shm_ring_impl(const std::string& path)
+        : role_(reader), closed_(false)
+    {
+        file_.open(path, mapped_file::readwrite);
+        header_ = reinterpret_cast<shm_ring_header*>(file_.data());
+        if ( file_.size() < shm_ring_header::size ||
+             header_->magic.load() != shm_ring_header::magic_value ||
+             file_.size() != shm_ring_header::size + header_->capacity )
+        {
+            boost::throw_exception(
+                BOOST_IOSTREAMS_FAILURE("not a shared-memory ring")
+            );
+        }
+        init();
+    }
+
+    ~shm_ring_impl()
+    {
+        try {
+            close();
+        } catch (...) { }
+    }
+
+    std::size_t capacity() const { return mask_ + 1; }
+
+    //----------Writer interface----------------------------------------------//
+
+    // Returns the free space which follows the last character written,
+    // waiting until there is some; throws if the reader has closed its end.
+    std::pair<char*, char*> writable()
+    {
+        for (int z = 0; ; ++z) {
+            check_reader();
+            boost::uint32_t event = header_->space_event.load();
+            std::size_t head = header_->head.load(std::memory_order_relaxed);
+            std::size_t tail = header_->tail.load(std::memory_order_acquire);
+            std::size_t offset = head & mask_;
+            std::size_t used = static_cast<boost::uint32_t>(head - tail);
+            std::size_t amt =
+                (std::min)(capacity() - used, capacity() - offset);
+            if (amt != 0)
+                return std::pair<char*, char*>(data_ + offset,
+                                               data_ + offset + amt);
+            wait( z, header_->writer_waiting, header_->space_event, event,
+                  &shm_ring_impl::has_space );
+        }
+    }
+
+    // Publishes n characters stored at the beginning of the space returned
+    // by writable().
+    void commit(std::size_t n)
+    {
+        header_->head.fetch_add(static_cast<boost::uint32_t>(n));
+        signal(header_->reader_waiting, header_->data_event);
+    }
+
+    // Copies n characters into the ring, waiting for space as needed.
+    void write(const char* s, std::size_t n)
+    {
+        while (n != 0) {
+            std::pair<char*, char*> p = writable();
+            std::size_t amt =
+                (std::min)(n, static_cast<std::size_t>(p.second - p.first));
+            std::memcpy(p.first, s, amt);
+            commit(amt);
+            s += amt;
+            n -= amt;
+        }
+    }
+
+    //----------Reader interface----------------------------------------------//
+
+    // Returns the characters which follow the last character read, waiting
+    // until there are some; returns an empty sequence at the end of the
+    // stream, which occurs when the writer has closed its end and all
+    // characters have been read.
+    std::pair<const char*, const char*> readable()
+    {
+        for (int z = 0; ; ++z) {
+            boost::uint32_t event = header_->data_event.load();
+            bool eof =
+                (header_->closed.load() & shm_ring_header::writer_closed) != 0;
+            std::size_t tail = header_->tail.load(std::memory_order_relaxed);
+            std::size_t head = header_->head.load(std::memory_order_acquire);
+            std::size_t offset = tail & mask_;
+            std::size_t amt =
+                (std::min)( static_cast<std::size_t>(
+                                static_cast<boost::uint32_t>(head - tail)
+                            ),
+                            capacity() - offset );
+            if (amt != 0 || eof)
+                return std::pair<const char*, const char*>(
+                           data_ + offset, data_ + offset + amt
+                       );
+            wait( z, header_->reader_waiting, header_->data_event, event,
+                  &shm_ring_impl::has_data );
+        }
+    }
+
+    // Releases n characters at the beginning of the sequence returned by
+    // readable().
+    void consume(std::size_t n)
+    {
+        header_->tail.fetch_add(static_cast<boost::uint32_t>(n));
+        signal(header_->writer_waiting, header_->space_event);
+    }
+
+    // Copies up to n characters from the ring, waiting until there is at
+    // least one; returns -1 at the end of the stream.
+    std::streamsize read(char* s, std::streamsize n)
+    {
+        std::pair<const char*, const char*> p = readable();
+        if (p.first == p.second)
+            return -1;
+        std::streamsize result = 0;
+        while (result < n && p.first != p.second) {
+            std::size_t amt =
+                (std::min)( static_cast<std::size_t>(n - result),
+                            static_cast<std::size_t>(p.second - p.first) );
+            std::memcpy(s + result, p.first, amt);
+            consume(amt);
+            result += static_cast<std::streamsize>(amt);
+            if (result < n && available() != 0)
+                p = readable();
+            else
+                break;
+        }
+        return result;
+    }
+
+    //----------Closing-------------------------------------------------------//
+
+    void close()
+    {
+        if (closed_)
+            return;
+        closed_ = true;
+        if (role_ == writer) {
+            header_->closed.fetch_or(shm_ring_header::writer_closed);
+            header_->data_event.fetch_add(1);
+            shm_ring_wake(header_->data_event);
+        } else {
+            header_->closed.fetch_or(shm_ring_header::reader_closed);
+            header_->space_event.fetch_add(1);
+            shm_ring_wake(header_->space_event);
+        }
+    }
+private:
+    shm_ring_impl(const shm_ring_impl&);
+    shm_ring_impl& operator=(const shm_ring_impl&);
+
+    void init()
+    {
+        data_ = file_.data() + shm_ring_header::size;
+        mask_ = header_->capacity - 1;
+    }
+
+    std::size_t available() const
+    {
+        return static_cast<boost::uint32_t>(
+                   header_->head.load() - header_->tail.load()
+               );
+    }
+
+    bool has_space() const
+    {
+        return available() < capacity() ||
+               (header_->closed.load() & shm_ring_header::reader_closed) != 0;
+    }
+
+    bool has_data() const
+    {
+        return available() != 0 ||
+               (header_->closed.load() & shm_ring_header::writer_closed) != 0;
+    }
+
+    void check_reader() const
+    {
+        if ((header_->closed.load() & shm_ring_header::reader_closed) != 0)
+            boost::throw_exception(
+                BOOST_IOSTREAMS_FAILURE("shared-memory ring reader closed")
+            );
+    }
+
+    // Waits for the condition tested by ready, given the value of event
+    // observed before the condition was last found false. The first
+    // spin_count attempts yield the processor instead of sleeping.
+    void wait( int attempt, shm_ring_word& waiting, shm_ring_word& event,
+               boost::uint32_t value, bool (shm_ring_impl::*ready)() const )
+    {
+        if (attempt < spin_count) {
+            std::this_thread::yield();
+            return;
+        }
+        waiting.fetch_add(1);
+        if (!(this->*ready)())
+            shm_ring_wait(event, value);
+        waiting.fetch_sub(1);
+    }
+
+    // Wakes the other process if it is waiting on event.
+    void signal(shm_ring_word& waiting, shm_ring_word& event)
+    {
+        if (waiting.load() != 0) {
+            event.fetch_add(1);
+            shm_ring_wake(event);
+        }
+    }
+
+    mapped_file        file_;
+    shm_ring_header*   header_;
+    char*              data_;
+    std::size_t        mask_;
+    role               role_;
+    bool               closed_;
+};
+
+} // End namespace detail.
+
+//
+// Class name: shm_ring_sink.
+// Description: Sink which writes to a ring buffer in a memory-mapped file,
+//      for reading by a shm_ring_source in the same or another process. The
+//      file is created, or truncated, by the constructor and is not removed;
+//      on POSIX systems it is typically placed under /dev/shm. write()
+//      blocks while the ring is full and throws once the reader has closed
+//      its end. Copies share their state; the writer's end is closed by
+//      close() or by the destruction of the last copy.
+//
+class shm_ring_sink {
+public:
+    typedef char char_type;
+    struct category
+        : sink_tag,
+          closable_tag
+        { };
+    BOOST_STATIC_CONSTANT(std::size_t, default_capacity = 1024 * 1024);
+    explicit shm_ring_sink( const std::string& path,
+                            std::size_t capacity = default_capacity )
+        : pimpl_(new detail::shm_ring_impl(path, capacity))
+        { }
+    std::streamsize write(const char_type* s, std::streamsize n)
+    {
+        pimpl_->write(s, static_cast<std::size_t>(n));
+        return n;
+    }
+    void close() { pimpl_->close(); }
+    std::size_t capacity() const { return pimpl_->capacity(); }
+
+    // Direct access: writable() returns free space in the ring, waiting
+    // until there is some, and commit() publishes characters stored there.
+    std::pair<char_type*, char_type*> writable() { return pimpl_->writable(); }
+    void commit(std::size_t n) { pimpl_->commit(n); }
+private:
+    shared_ptr<detail::shm_ring_impl> pimpl_;
+};
+
+//
+// Class name: shm_ring_source.
+// Description: Source which reads from a ring buffer created by a
+//      shm_ring_sink. read() blocks while the ring is empty and reports the
+//      end of the stream once the writer has closed its end and all
+//      characters have been read. Copies share their state; the reader's end
+//      is closed by close() or by the destruction of the last copy.
+//
+class shm_ring_source {
+public:
+    typedef char char_type;
+    struct category
+        : source_tag,
+          closable_tag
+        { };
+    explicit shm_ring_source(const std::string& path)
+        : pimpl_(new detail::shm_ring_impl(path))
+        { }
+    std::streamsize read(char_type* s, std::streamsize n)
+    { return pimpl_->read(s, n); }
+    void close() { pimpl_->close(); }
+    std::size_t capacity() const { return pimpl_->capacity(); }
+
+    // Direct access: readable() returns characters in the ring, waiting
+    // until there are some, or an empty sequence at the end of the stream;
+    // consume() releases characters obtained from readable().
+    std::pair<const char_type*, const char_type*> readable()
+    { return pimpl_->readable(); }
+    void consume(std::size_t n) { pimpl_->consume(n); }
+private:
+    shared_ptr<detail::shm_ring_impl> pimpl_;
+};
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>  // MSVC.
+
+#endif // #ifndef BOOST_IOSTREAMS_SHM_RING_HPP_INCLUDED
@@ -20,6 +20,7 @@
 #include <boost/iostreams/categories.hpp>
 #include <boost/iostreams/detail/char_traits.hpp>
 #include <boost/iostreams/detail/ios.hpp>     // openmode, streamsize.
+#include <boost/iostreams/detail/spool.hpp>
 #include <boost/iostreams/pipeline.hpp>
 #include <boost/iostreams/read.hpp>           // check_eof 
 #include <boost/iostreams/write.hpp>
@@ -38,7 +39,8 @@ namespace boost { namespace iostreams {
 //      Alloc - The allocator type.
 // Description: Utility for defining DualUseFilters which filter an
 //      entire stream at once. To use, override the protected virtual
-//      member do_filter.
+//      member do_filter. The entire stream is held in memory; see
+//      range_aggregate_filter for a bounded alternative.
 // Note: This filter should not be copied while it is in use.
 //
 template<typename Ch, typename Alloc = std::allocator<Ch> >
@@ -161,6 +163,150 @@ private:
 };
 BOOST_IOSTREAMS_PIPABLE(aggregate_filter, 1)
 
+//
+// Template name: range_aggregate_filter.
+// Template parameters:
+//      Ch - The character type.
+//      Alloc - The allocator type.
+// Description: Utility for defining DualUseFilters which filter an
+//      entire stream at once, examining it in place. To use, override the
+//      private virtual member do_filter_range. If a memory limit is
+//      specified, input and output beyond the limit are held in temporary
+//      files which are mapped into memory when needed.
+// Note: This filter should not be copied while it is in use; copying it
+//      throws once its data has been moved to a temporary file.
+//
+template<typename Ch, typename Alloc = std::allocator<Ch> >
+class range_aggregate_filter  {
+public:
+    typedef Ch char_type;
+    struct category
+        : dual_use,
+          filter_tag,
+          multichar_tag,
+          closable_tag
+        { };
+    explicit range_aggregate_filter(std::streamsize memory_limit = 0)
+        : input_(memory_limit), output_(memory_limit), view_(0), ptr_(0),
+          state_(0)
+        { BOOST_ASSERT(memory_limit >= 0); }
+    virtual ~range_aggregate_filter() { }
+
+    template<typename Source>
+    std::streamsize read(Source& src, char_type* s, std::streamsize n)
+    {
+        BOOST_ASSERT(!(state_ & f_write));
+        state_ |= f_read;
+        if (!(state_ & f_eof))
+            do_read(src);
+        std::streamsize amt = (std::min)(n, output_.size() - ptr_);
+        if (amt) {
+            BOOST_IOSTREAMS_CHAR_TRAITS(char_type)::copy(s, view_ + ptr_, amt);
+            ptr_ += amt;
+        }
+        return detail::check_eof(amt);
+    }
+
+    template<typename Sink>
+    std::streamsize write(Sink&, const char_type* s, std::streamsize n)
+    {
+        BOOST_ASSERT(!(state_ & f_read));
+        state_ |= f_write;
+        input_.write(s, n);
+        return n;
+    }
+
+    template<typename Sink>
+    void close(Sink& sink, BOOST_IOS::openmode which)
+    {
+        if ((state_ & f_read) != 0 && which == BOOST_IOS::in)
+            close_impl();
+        if ((state_ & f_write) != 0 && which == BOOST_IOS::out) {
+            try {
+                filter_input();
+                do_write(sink, output_.data(), output_.size());
+            } catch (...) {
+                close_impl();
+                throw;
+            }
+            close_impl();
+        }
+    }
+
+protected:
+    typedef detail::spool<Ch, Alloc>  spool_type;
+private:
+
+    // Filters [first, last), appending the result to dest using its member
+    // write().
+    virtual void do_filter_range( const char_type* first,
+                                  const char_type* last,
+                                  spool_type& dest ) = 0;
+    virtual void do_close() { }
+
+    // Filters input_ into output_, discarding input_.
+    void filter_input()
+    {
+        const char_type* first = input_.data();
+        do_filter_range(first, first + input_.size(), output_);
+        input_.clear();
+    }
+
+    template<typename Source>
+    void do_read(Source& src)
+    {
+        while (true) {
+            const std::streamsize  size = default_device_buffer_size;
+            Ch                     buf[size];
+            std::streamsize        amt;
+            if ((amt = boost::iostreams::read(src, buf, size)) == -1)
+                break;
+            input_.write(buf, amt);
+        }
+        filter_input();
+        view_ = output_.data();
+        state_ |= f_eof;
+    }
+
+    template<typename Sink>
+    void do_write(Sink& sink, const char_type* s, std::streamsize n) 
+    { 
+        typedef typename iostreams::category_of<Sink>::type  category;
+        typedef is_convertible<category, output>             can_write;
+        do_write(sink, s, n, can_write()); 
+    }
+
+    template<typename Sink>
+    void do_write(Sink& sink, const char_type* s, std::streamsize n, mpl::true_) 
+    { iostreams::write(sink, s, n); }
+
+    template<typename Sink>
+    void do_write(Sink&, const char_type*, std::streamsize, mpl::false_) { }
+
+    void close_impl()
+    {
+        input_.clear();
+        output_.clear();
+        view_ = 0;
+        ptr_ = 0;
+        state_ = 0;
+        do_close();
+    }
+
+    enum flag_type {
+        f_read   = 1,
+        f_write  = f_read << 1,
+        f_eof    = f_write << 1
+    };
+
+    spool_type        input_;
+    spool_type        output_;
+    const char_type*  view_;    // Contents of output_ while reading.
+    std::streamsize   ptr_;
+    int               state_;
+};
+BOOST_IOSTREAMS_PIPABLE(range_aggregate_filter, 1)
+
 } } // End namespaces iostreams, boost.
 
 #include <boost/iostreams/detail/config/enable_warnings.hpp>  // MSVC.
@@ -12,22 +12,114 @@
 # pragma once
 #endif
 
-#include <algorithm>  // count.
+#include <cstddef>    // size_t.
+#include <istream>
+#include <ostream>
+#include <string>
+#include <vector>
 #include <boost/iostreams/categories.hpp>
 #include <boost/iostreams/char_traits.hpp>
+#include <boost/iostreams/detail/ios.hpp>   // failure.
+#include <boost/iostreams/detail/scan.hpp>  // count_char, find_char.
 #include <boost/iostreams/operations.hpp>
 #include <boost/iostreams/pipeline.hpp>
+#include <boost/iostreams/positioning.hpp>  // stream_offset.
+#include <boost/throw_exception.hpp>
 
 // Must come last.
 #include <boost/iostreams/detail/config/disable_warnings.hpp> // VC7.1 C4244.
 
 namespace boost { namespace iostreams {
 
+//
+// Class name: line_index.
+// Description: Sparse index recording the character offset at which every
+//      interval-th line of a character sequence begins. An index may be
+//      saved alongside the sequence it describes and later used to seek
+//      close to a given line without rescanning the preceding lines.
+//
+class line_index {
+public:
+    explicit line_index(stream_offset interval = 0, stream_offset first_line = 0)
+        : interval_(interval), first_line_(first_line)
+        { }
+    stream_offset interval() const { return interval_; }
+    stream_offset first_line() const { return first_line_; }
+    std::size_t size() const { return offsets_.size(); }
+    bool empty() const { return offsets_.empty(); }
+
+    // Returns the number of the i-th indexed line.
+    stream_offset line(std::size_t i) const
+    { return first_line_ + static_cast<stream_offset>(i) * interval_; }
+
+    // Returns the offset of the i-th indexed line.
+    stream_offset offset(std::size_t i) const { return offsets_[i]; }
+    void push_back(stream_offset off) { offsets_.push_back(off); }
+    void clear() { offsets_.clear(); }
+
+    // Returns the position of the last indexed line not following the given
+    // line, or size() if there is none.
+    std::size_t find(stream_offset line) const
+    {
+        if (empty() || interval_ <= 0 || line < first_line_)
+            return size();
+        stream_offset i = (line - first_line_) / interval_;
+        return i < static_cast<stream_offset>(size()) ?
+            static_cast<std::size_t>(i) :
+            size() - 1;
+    }
+
+    // Writes the index in a portable text format.
+    void save(std::ostream& out) const
+    {
+        out << "boost_iostreams_line_index 1\n"
+            << interval_ << ' ' << first_line_ << ' ' << size() << '\n';
+        for (std::size_t z = 0, n = size(); z < n; ++z)
+            out << offsets_[z] << '\n';
+        if (!out)
+            boost::throw_exception(BOOST_IOSTREAMS_FAILURE("write error"));
+    }
+
+    // Replaces the index with one written by save().
+    void load(std::istream& in)
+    {
+        std::string    tag;
+        int            version = 0;
+        stream_offset  interval = 0, first_line = 0;
+        std::size_t    n = 0;
+        in >> tag >> version >> interval >> first_line >> n;
+        if ( !in || tag != "boost_iostreams_line_index" || version != 1 ||
+             interval <= 0 )
+        {
+            boost::throw_exception(BOOST_IOSTREAMS_FAILURE("bad line index"));
+        }
+        std::vector<stream_offset> offsets;
+        for (std::size_t z = 0; z < n; ++z) {
+            stream_offset off;
+            if (!(in >> off) || (z != 0 && off < offsets.back()))
+                boost::throw_exception(
+                    BOOST_IOSTREAMS_FAILURE("bad line index")
+                );
+            offsets.push_back(off);
+        }
+        interval_ = interval;
+        first_line_ = first_line;
+        offsets_.swap(offsets);
+    }
+private:
+    stream_offset               interval_;
+    stream_offset               first_line_;
+    std::vector<stream_offset>  offsets_;
+};
+
 //
 // Template name: basic_counter.
 // Template parameters:
 //      Ch - The character type.
-// Description: Filter which counts lines and characters.
+// Description: Filter which counts lines and characters. Optionally builds
+//      a line_index holding the offset of every index_interval-th line; an
+//      index_interval of zero builds no index, and a negative one is an
+//      error.
 //
 template<typename Ch>
 class basic_counter  {
@@ -39,11 +131,22 @@ public:
           multichar_tag,
           optimally_buffered_tag
         { };
-    explicit basic_counter(int first_line = 0, int first_char = 0)
-        : lines_(first_line), chars_(first_char)
-        { }
-    int lines() const { return lines_; }
-    int characters() const { return chars_; }
+    explicit basic_counter( stream_offset first_line = 0,
+                            stream_offset first_char = 0,
+                            stream_offset index_interval = 0 )
+        : lines_(first_line), chars_(first_char),
+          index_(index_interval, first_line)
+    {
+        if (index_interval < 0)
+            boost::throw_exception(
+                BOOST_IOSTREAMS_FAILURE("bad index interval")
+            );
+        if (index_interval != 0)
+            index_.push_back(first_char);
+    }
+    stream_offset lines() const { return lines_; }
+    stream_offset characters() const { return chars_; }
+    const line_index& index() const { return index_; }
     std::streamsize optimal_buffer_size() const { return 0; }
 
     template<typename Source>
@@ -52,8 +155,7 @@ public:
         std::streamsize result = iostreams::read(src, s, n);
         if (result == -1)
             return -1;
-        lines_ += std::count(s, s + result, char_traits<Ch>::newline());
-        chars_ += result;
+        count(s, result);
         return result;
     }
 
@@ -61,13 +163,40 @@ public:
     std::streamsize write(Sink& snk, const char_type* s, std::streamsize n)
     {
         std::streamsize result = iostreams::write(snk, s, n);
-        lines_ += std::count(s, s + result, char_traits<Ch>::newline());
-        chars_ += result;
+        count(s, result);
         return result;
     }
 private:
-    int lines_;
-    int chars_;
+    void count(const char_type* s, std::streamsize n)
+    {
+        const char_type *first = s, *last = s + n;
+        stream_offset lines = count_newlines(first, last);
+        if (index_.interval() != 0) {
+            stream_offset next = index_.line(index_.size());
+            while (lines_ + lines >= next) {
+
+                // Locate the newline ending the line preceding line next.
+                for (; lines_ != next; ++lines_, --lines)
+                    first = find_newline(first, last) + 1;
+                index_.push_back(chars_ + (first - s));
+                next += index_.interval();
+            }
+        }
+        lines_ += lines;
+        chars_ += n;
+    }
+    static stream_offset count_newlines(const Ch* first, const Ch* last)
+    {
+        return static_cast<stream_offset>(
+                   detail::count_char(first, last, char_traits<Ch>::newline())
+               );
+    }
+    static const Ch* find_newline(const Ch* first, const Ch* last)
+    { return detail::find_char(first, last, char_traits<Ch>::newline()); }
+
+    stream_offset  lines_;
+    stream_offset  chars_;
+    line_index     index_;
 };
 BOOST_IOSTREAMS_PIPABLE(basic_counter, 1)
 
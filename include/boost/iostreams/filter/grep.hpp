@@ -23,39 +23,352 @@
 
 #include <iostream>
 
-#include <memory>  // allocator.
+#include <algorithm>  // equal, search.
+#include <cstddef>    // size_t.
+#include <memory>     // allocator.
+#include <string>
+#include <vector>
 #include <boost/iostreams/char_traits.hpp>   
+#include <boost/iostreams/detail/aho_corasick.hpp>
+#include <boost/iostreams/detail/scan.hpp>  // count_char, find_char.
 #include <boost/iostreams/filter/line.hpp>              
 #include <boost/iostreams/pipeline.hpp>
+#include <boost/iostreams/positioning.hpp>  // stream_offset.
 #include <boost/regex.hpp>
+#include <boost/shared_ptr.hpp>
 
 namespace boost { namespace iostreams {
 
 namespace grep {
 
-const int invert      = 1;
-const int whole_line  = invert << 1;
+const int invert        = 1;
+const int whole_line    = invert << 1;
+const int fixed_string  = whole_line << 1;
 
 } // End namespace grep.
 
+namespace detail {
+
+// Stores in result the longest string which must occur in any match of
+// the given regular expression, as far as can be determined from a simple
+// scan of its Perl syntax; returns false if no such string was found.
+template<typename Ch, typename Tr>
+bool grep_required_literal( const basic_regex<Ch, Tr>& re,
+                            std::basic_string<Ch>& result )
+{
+    typedef std::basic_string<Ch>  string_type;
+    typedef std::size_t            size_type;
+
+    regbase::flag_type flags = re.flags();
+    string_type pattern = re.str();
+    if ((flags & (regbase::icase | regbase::mod_x | regbase::newline_alt)) != 0)
+        return false;
+    if ((flags & regbase::literal) != 0) {
+        result = pattern;
+        return !result.empty() && 
+               result.find(Ch('\n')) == string_type::npos;
+    }
+    if ((flags & regbase::main_option_type) != regbase::perl_syntax_group)
+        return false;
+
+    string_type  run, best;
+    size_type    n = pattern.size(), i = 0;
+    int          depth = 0;
+    while (i < n) {
+        Ch c = pattern[i];
+
+        // Skip bracket expressions.
+        if (c == Ch('[')) {
+            if (depth == 0 && run.size() > best.size())
+                best = run;
+            run.clear();
+            size_type j = i + 1;
+            if (j < n && pattern[j] == Ch('^'))
+                ++j;
+            if (j < n && pattern[j] == Ch(']'))
+                ++j;
+            for (; j < n && pattern[j] != Ch(']'); ++j) {
+                if (pattern[j] == Ch('\\'))
+                    ++j;
+                else if ( pattern[j] == Ch('[') && j + 1 < n &&
+                          ( pattern[j + 1] == Ch(':') || 
+                            pattern[j + 1] == Ch('.') ||
+                            pattern[j + 1] == Ch('=') ) )
+                {
+                    Ch delim = pattern[j + 1];
+                    for (j += 2; j + 1 < n; ++j)
+                        if (pattern[j] == delim && pattern[j + 1] == Ch(']'))
+                            break;
+                    ++j;
+                }
+            }
+            if (j >= n)
+                return false;
+            i = j + 1;
+            continue;
+        }
+
+        // Ignore the contents of groups, which may be optional or contain
+        // alternatives; reject inline modifiers, which may change the 
+        // meaning of what follows.
+        if (c == Ch('(')) {
+            if (i + 1 < n && pattern[i + 1] == Ch('?')) {
+                Ch d = i + 2 < n ? pattern[i + 2] : Ch(0);
+                if ( d != Ch(':') && d != Ch('=') && d != Ch('!') &&
+                     d != Ch('<') && d != Ch('>') )
+                {
+                    return false;
+                }
+            }
+            if (depth++ == 0 && run.size() > best.size())
+                best = run;
+            run.clear();
+            ++i;
+            continue;
+        }
+        if (c == Ch(')')) {
+            --depth;
+            ++i;
+            continue;
+        }
+        if (depth > 0) {
+            i += c == Ch('\\') ? 2 : 1;
+            continue;
+        }
+        if (c == Ch('|'))
+            return false;
+
+        // Determine the literal character, if any, at position i.
+        Ch          lit = c;
+        size_type   len = 1;
+        bool        is_literal = true;
+        if (c == Ch('\\')) {
+            if (i + 1 >= n)
+                return false;
+            Ch d = pattern[i + 1];
+            bool alnum = 
+                (d >= Ch('0') && d <= Ch('9')) || 
+                (d >= Ch('a') && d <= Ch('z')) ||
+                (d >= Ch('A') && d <= Ch('Z'));
+            if (alnum) {
+                static const char classes[] = "dDwWsSbBAzZ";
+                bool known = false;
+                for (const char* p = classes; *p; ++p)
+                    if (d == Ch(*p))
+                        known = true;
+                if (!known)
+                    return false;
+                is_literal = false;
+            } else if ( d == Ch('<') || d == Ch('>') || d == Ch('`') ||
+                        d == Ch('\'') )
+            {
+                is_literal = false;  // Word and buffer boundaries, like \b.
+            }
+            lit = d;
+            len = 2;
+        } else if ( c == Ch('.') || c == Ch('^') || c == Ch('$') ||
+                    c == Ch('*') || c == Ch('+') || c == Ch('?') || 
+                    c == Ch('{') )
+        {
+            is_literal = false;
+
+            // Skip a quantifier applied to a preceding group or bracket 
+            // expression.
+            if (c == Ch('{')) {
+                while (i + len < n && pattern[i + len - 1] != Ch('}'))
+                    ++len;
+            }
+        }
+        if (is_literal && lit == Ch('\n'))
+            return false;
+
+        // Apply any quantifier.
+        i += len;
+        bool required = is_literal, repeated = false;
+        if (i < n) {
+            Ch q = pattern[i];
+            if (q == Ch('*') || q == Ch('?')) {
+                required = false;
+                repeated = true;
+                ++i;
+            } else if (q == Ch('+')) {
+                repeated = true;
+                ++i;
+            } else if (q == Ch('{')) {
+                size_type j = i + 1;
+                bool zero = true;
+                for (; j < n && pattern[j] >= Ch('0') && pattern[j] <= Ch('9'); ++j)
+                    if (pattern[j] != Ch('0'))
+                        zero = false;
+                while (j < n && pattern[j] != Ch('}'))
+                    ++j;
+                if (j == n)
+                    return false;
+                if (zero)
+                    required = false;
+                repeated = true;
+                i = j + 1;
+            }
+            if (repeated && i < n && (pattern[i] == Ch('?') || pattern[i] == Ch('+')))
+                ++i;
+        }
+        if (required)
+            run += lit;
+        if (!is_literal || repeated) {
+            if (run.size() > best.size())
+                best = run;
+            run.clear();
+        }
+    }
+    if (run.size() > best.size())
+        best = run;
+    result = best;
+    return !result.empty();
+}
+
+//
+// Template name: grep_patterns.
+// Template parameters:
+//      Ch - The character type.
+//      Tr - The regular expression traits type.
+// Description: The patterns of a basic_grep_filter, together with an
+//      automaton which locates occurrences of literals at least one of
+//      which must occur in any matching line. If some pattern has no such
+//      literal, every line must be tested.
+//
+template<typename Ch, typename Tr>
+class grep_patterns {
+public:
+    typedef std::basic_string<Ch>                     string_type;
+    typedef basic_regex<Ch, Tr>                       regex_type;
+    typedef regex_constants::match_flag_type          match_flag_type;
+    grep_patterns() : prefilter_(true), compiled_(false) { }
+    void add(const regex_type& re)
+    {
+        string_type lit;
+        if (grep_required_literal(re, lit))
+            literals_.push_back(lit);
+        else
+            prefilter_ = false;
+        regexes_.push_back(re);
+        compiled_ = false;
+    }
+    void add_fixed(const string_type& pattern)
+    {
+        // A pattern containing a newline can never occur within a line.
+        if (pattern.find(char_traits<Ch>::newline()) != string_type::npos)
+            return;
+        if (pattern.empty())
+            prefilter_ = false;
+        fixed_.push_back(pattern);
+        literals_.push_back(pattern);
+        compiled_ = false;
+    }
+    bool compiled() const { return compiled_; }
+    void compile()
+    {
+        automaton_ = automaton_type();
+        for (std::size_t z = 0, n = literals_.size(); z < n; ++z)
+            automaton_.add(literals_[z], string_type());
+        automaton_.compile();
+        compiled_ = true;
+    }
+
+    // Returns true if lines not containing a literal cannot match.
+    bool prefilter() const { return prefilter_; }
+
+    // Returns true if every line containing a literal matches.
+    bool fixed_only() const { return prefilter_ && regexes_.empty(); }
+
+    // Returns the position of the last character of the first occurrence of
+    // a literal in [first, last), or last if there is none.
+    const Ch* find(const Ch* first, const Ch* last) const
+    {
+        int s = 0;
+        while (first != last) {
+            if (s == 0 && (first = automaton_.skip(first, last)) == last)
+                break;
+            s = automaton_.next(s, *first);
+            if (automaton_.match_length(s) != 0)
+                return first;
+            ++first;
+        }
+        return last;
+    }
+
+    bool matches( const Ch* first, const Ch* last, 
+                  match_flag_type flags, bool whole_line ) const
+    {
+        for (std::size_t z = 0, n = fixed_.size(); z < n; ++z) {
+            const string_type& f = fixed_[z];
+            if ( whole_line ?
+                     static_cast<std::size_t>(last - first) == f.size() &&
+                         std::equal(first, last, f.begin()) :
+                     std::search(first, last, f.begin(), f.end()) != last ||
+                         f.empty() )
+            {
+                return true;
+            }
+        }
+        for (std::size_t z = 0, n = regexes_.size(); z < n; ++z)
+            if ( whole_line ?
+                     regex_match(first, last, regexes_[z], flags) :
+                     regex_search(first, last, regexes_[z], flags) )
+            {
+                return true;
+            }
+        return false;
+    }
+private:
+    typedef aho_corasick<Ch>  automaton_type;
+    std::vector<regex_type>   regexes_;
+    std::vector<string_type>  fixed_;
+    std::vector<string_type>  literals_;
+    automaton_type            automaton_;
+    bool                      prefilter_;
+    bool                      compiled_;
+};
+
+} // End namespace detail.
+
+//
+// Template name: basic_grep_filter.
+// Template parameters:
+//      Ch - The character type.
+//      Tr - The regular expression traits type.
+//      Alloc - The allocator type.
+// Description: Filter which passes through the lines matching one or more
+//      regular expressions or fixed strings. Lines are located a buffer at a
+//      time; where every pattern requires a literal string, the buffer is
+//      scanned for the literals and only the lines containing them are
+//      matched against the patterns.
+//
 template< typename Ch,
           typename Tr = regex_traits<Ch>,
           typename Alloc = std::allocator<Ch> >
-class basic_grep_filter : public basic_line_filter<Ch, Alloc> {
+class basic_grep_filter : public basic_line_view_filter<Ch, Alloc> {
 private:
-    typedef basic_line_filter<Ch, Alloc>               base_type;
+    typedef basic_line_view_filter<Ch, Alloc>          base_type;
+    typedef detail::grep_patterns<Ch, Tr>              patterns_type;
 public:
     typedef typename base_type::char_type              char_type;
     typedef typename base_type::category               category;
     typedef char_traits<char_type>                     traits_type;
     typedef typename base_type::string_type            string_type;
+    typedef typename base_type::view_type              view_type;
     typedef basic_regex<Ch, Tr>                        regex_type;
     typedef regex_constants::match_flag_type           match_flag_type;
     basic_grep_filter( const regex_type& re,
                        match_flag_type match_flags = 
                            regex_constants::match_default,
                        int options = 0 );
-    int count() const { return count_; }
+    explicit basic_grep_filter(const string_type& pattern, int options = 0);
+
+    // Adds a pattern; a line passes through if it matches any pattern.
+    // Filters copied from this one are not affected.
+    void add(const regex_type& re);
+    void add(const string_type& pattern);
+    stream_offset count() const { return count_; }
 
     template<typename Sink>
     void close(Sink& snk, BOOST_IOS::openmode which)
@@ -64,20 +377,49 @@ public:
         options_ &= ~f_initialized;
     }
 private:
-    virtual string_type do_filter(const string_type& line)
+    virtual void do_filter(view_type line, string_type& out)
+    {
+        initialize();
+        const char_type *first = line.data(), *last = first + line.size();
+        select(first, last, patterns().matches(first, last, match_flags_, 
+                                               whole_line()), out);
+    }
+    virtual void do_filter_lines(view_type lines, string_type& out);
+    void initialize()
     {
         if ((options_ & f_initialized) == 0) {
             options_ |= f_initialized;
             count_ = 0;
         }
-        bool matches = (options_ & grep::whole_line) ?
-            regex_match(line, re_, match_flags_) :
-            regex_search(line, re_, match_flags_);
+    }
+    const patterns_type& patterns()
+    {
+        if (!patterns_->compiled()) {
+            if (!patterns_.unique())
+                patterns_.reset(new patterns_type(*patterns_));
+            patterns_->compile();
+        }
+        return *patterns_;
+    }
+    patterns_type& mutable_patterns()
+    {
+        if (!patterns_.unique())
+            patterns_.reset(new patterns_type(*patterns_));
+        return *patterns_;
+    }
+    bool whole_line() const { return (options_ & grep::whole_line) != 0; }
+
+    // Passes through the line [first, last) if it is selected.
+    void select( const char_type* first, const char_type* last, 
+                 bool matches, string_type& out )
+    {
         if (options_ & grep::invert)
             matches = !matches;
-        if (matches)
+        if (matches) {
             ++count_;
-        return matches ? line + traits_type::newline() : string_type();
+            out.append(first, last);
+            out += traits_type::newline();
+        }
     }
 
     // Private flags bitwise OR'd with constants from namespace grep
@@ -85,10 +427,10 @@ private:
         f_initialized = 65536
     };
 
-    regex_type       re_;
-    match_flag_type  match_flags_;
-    int              options_;
-    int              count_;
+    shared_ptr<patterns_type>  patterns_;
+    match_flag_type            match_flags_;
+    int                        options_;
+    stream_offset              count_;
 };
 BOOST_IOSTREAMS_PIPABLE(basic_grep_filter, 3)
 
@@ -100,9 +442,74 @@ typedef basic_grep_filter<wchar_t>  wgrep_filter;
 template<typename Ch, typename Tr, typename Alloc>
 basic_grep_filter<Ch, Tr, Alloc>::basic_grep_filter
     (const regex_type& re, match_flag_type match_flags, int options)
-    : base_type(true), re_(re), match_flags_(match_flags), 
-      options_(options), count_(0)
-    { }
+    : base_type(true), patterns_(new patterns_type), 
+      match_flags_(match_flags), options_(options), count_(0)
+    { patterns_->add(re); }
+
+template<typename Ch, typename Tr, typename Alloc>
+basic_grep_filter<Ch, Tr, Alloc>::basic_grep_filter
+    (const string_type& pattern, int options)
+    : base_type(true), patterns_(new patterns_type), 
+      match_flags_(regex_constants::match_default), options_(options), 
+      count_(0)
+    { add(pattern); }
+
+template<typename Ch, typename Tr, typename Alloc>
+void basic_grep_filter<Ch, Tr, Alloc>::add(const regex_type& re)
+{ mutable_patterns().add(re); }
+
+template<typename Ch, typename Tr, typename Alloc>
+void basic_grep_filter<Ch, Tr, Alloc>::add(const string_type& pattern)
+{
+    if (options_ & grep::fixed_string)
+        mutable_patterns().add_fixed(pattern);
+    else
+        mutable_patterns().add(regex_type(pattern));
+}
+
+template<typename Ch, typename Tr, typename Alloc>
+void basic_grep_filter<Ch, Tr, Alloc>::do_filter_lines
+    (view_type lines, string_type& out)
+{
+    initialize();
+    const patterns_type&  pats = patterns();
+    const char_type       nl = traits_type::newline();
+    const char_type      *first = lines.data(), *last = first + lines.size();
+    if (!pats.prefilter()) {
+        for (const char_type* next; first != last; first = next + 1) {
+            next = detail::find_char(first, last, nl);
+            select( first, next, 
+                    pats.matches(first, next, match_flags_, whole_line()), 
+                    out );
+        }
+        return;
+    }
+
+    // Every line matching a pattern contains a literal: test only the lines
+    // containing literals. With grep::invert, the lines between them are
+    // passed through unexamined.
+    bool invert = (options_ & grep::invert) != 0;
+    bool confirm = !pats.fixed_only() || whole_line();
+    while (first != last) {
+        const char_type* hit = pats.find(first, last);
+        const char_type* begin = hit;
+        while (begin != first && !traits_type::eq(begin[-1], nl))
+            --begin;
+        if (invert) {
+            out.append(first, begin);
+            count_ += static_cast<stream_offset>(
+                          detail::count_char(first, begin, nl)
+                      );
+        }
+        if (hit == last)
+            break;
+        const char_type* end = detail::find_char(hit, last, nl);
+        select( begin, end, 
+                !confirm || pats.matches(begin, end, match_flags_, whole_line()),
+                out );
+        first = end + 1;
+    }
+}
 
 } } // End namespaces iostreams, boost.
 
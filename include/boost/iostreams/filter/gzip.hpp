@@ -271,6 +271,7 @@ public:
         }
         close_impl();
     }
+    int level() { return base_type::level(); }
 private:
     static gzip_params normalize_params(gzip_params p);
     void prepare_footer();
@@ -12,14 +12,19 @@
 # pragma once
 #endif
 
-#include <algorithm>                               // min.
+#include <algorithm>                               // min, max.
 #include <boost/assert.hpp>
+#include <cstddef>                                 // size_t.
 #include <memory>                                  // allocator.
 #include <string>
+#include <vector>
 #include <boost/config.hpp>                        // BOOST_STATIC_CONSTANT.
 #include <boost/iostreams/categories.hpp>
 #include <boost/iostreams/checked_operations.hpp>
+#include <boost/iostreams/constants.hpp>           // default_device_buffer_size.
+#include <boost/iostreams/detail/char_view.hpp>
 #include <boost/iostreams/detail/ios.hpp>          // openmode, streamsize.
+#include <boost/iostreams/detail/scan.hpp>         // find_char.
 #include <boost/iostreams/read.hpp>                // check_eof 
 #include <boost/iostreams/pipeline.hpp>
 #include <boost/iostreams/write.hpp>
@@ -214,6 +219,302 @@ BOOST_IOSTREAMS_PIPABLE(basic_line_filter, 2)
 typedef basic_line_filter<char>     line_filter;
 typedef basic_line_filter<wchar_t>  wline_filter;
 
+//
+// Template name: basic_line_view_filter.
+// Template parameters:
+//      Ch - The character type.
+//      Alloc - The allocator type.
+// Description: Filter which processes data one line at a time, like
+//      basic_line_filter, without allocating memory for each line. Lines are
+//      located a buffer at a time and passed to do_filter() as views of the
+//      buffer; do_filter() appends its output to a string which is reused
+//      from one line to the next.
+//
+template< typename Ch,
+          typename Alloc = std::allocator<Ch> >
+class basic_line_view_filter {
+private:
+    typedef typename std::basic_string<Ch>::traits_type  string_traits;
+public:
+    typedef Ch                                           char_type;
+    typedef char_traits<char_type>                       traits_type;
+    typedef std::basic_string<
+                Ch,
+                string_traits,
+                Alloc
+            >                                            string_type;
+    typedef detail::basic_char_view<Ch>                  view_type;
+    struct category
+        : dual_use,
+          filter_tag,
+          multichar_tag,
+          closable_tag
+        { };
+protected:
+    basic_line_view_filter( bool suppress_newlines = false,
+                            std::streamsize buffer_size = 
+                                default_device_buffer_size )
+        : buffer_size_(
+              static_cast<std::size_t>((std::max)(buffer_size, 
+                                                  std::streamsize(1)))
+          ),
+          ptr_(0), end_(0), out_ptr_(0),
+          flags_(suppress_newlines ? f_suppress : 0) 
+        { }
+public:
+    virtual ~basic_line_view_filter() { }
+
+    template<typename Source>
+    std::streamsize read(Source& src, char_type* s, std::streamsize n)
+    {
+        BOOST_ASSERT(!(flags_ & f_write));
+        flags_ |= f_read;
+
+        std::streamsize result = 0;
+        while (true) {
+            result += read_output(s + result, n - result);
+            if (result == n || (flags_ & f_eof) != 0 || !next_lines(src))
+                break;
+        }
+        return result != 0 || (flags_ & f_eof) == 0 ?
+            result :
+            -1;
+    }
+
+    template<typename Sink>
+    std::streamsize write(Sink& snk, const char_type* s, std::streamsize n)
+    {
+        BOOST_ASSERT(!(flags_ & f_read));
+        flags_ |= f_write;
+
+        // Handle unfinished business.
+        if (!flush(snk))
+            return 0;
+
+        // Complete the line begun by an earlier call, then filter the
+        // remaining full lines in [s, s + n) in place, about a buffer at a
+        // time, and write the output to snk in batches.
+        const char_type *first = s, *last = s + n;
+        const char_type* next = find_newline(first, last);
+        if (next != last && end_ != 0) {
+            append(first, next);
+            filter_line(&buf_[0], &buf_[0] + end_, true);
+            end_ = 0;
+            first = next + 1;
+            if (out_.size() >= buffer_size_ && !flush(snk))
+                return static_cast<std::streamsize>(first - s);
+        }
+        while (next != last) {
+            const char_type* limit =
+                static_cast<std::size_t>(last - first) > buffer_size_ ?
+                    first + buffer_size_ :
+                    last;
+            if ( (next = find_last_newline(first, limit)) == limit &&
+                 (next = find_newline(limit, last)) == last )
+            {
+                break;
+            }
+            filter_lines(first, next + 1);
+            first = next + 1;
+            if (out_.size() >= buffer_size_ && !flush(snk))
+                return static_cast<std::streamsize>(first - s);
+        }
+        append(first, last);
+        flush(snk);
+        return n;
+    }
+
+    template<typename Sink>
+    void close(Sink& snk, BOOST_IOS::openmode which)
+    {
+        if ((flags_ & f_read) && which == BOOST_IOS::in)
+            close_impl();
+
+        if ((flags_ & f_write) && which == BOOST_IOS::out) {
+            try {
+                if (end_ != 0)
+                    filter_line(&buf_[0], &buf_[0] + end_, false);
+                end_ = 0;
+                while (!flush(snk)) ;
+            } catch (...) {
+                try {
+                    close_impl();
+                } catch (...) { }
+                throw;
+            }
+            close_impl();
+        }
+    }
+private:
+
+    // Appends the filtered form of line, which does not include the line 
+    // terminator, to out.
+    virtual void do_filter(view_type line, string_type& out) = 0;
+
+    // Appends the filtered form of lines, a sequence of full lines each
+    // ending with a newline, to out. Derived classes may override this
+    // function to process many lines at once; the default implementation
+    // calls do_filter() for each line.
+    virtual void do_filter_lines(view_type lines, string_type& out)
+    {
+        const char_type *first = lines.data(), *last = first + lines.size(), 
+                        *next;
+        while ((next = find_newline(first, last)) != last) {
+            do_filter( view_type(first, static_cast<std::size_t>(next - first)),
+                       out );
+            if ((flags_ & f_suppress) == 0)
+                out += traits_type::newline();
+            first = next + 1;
+        }
+    }
+
+    static const char_type* 
+    find_newline(const char_type* first, const char_type* last)
+    { return detail::find_char(first, last, traits_type::newline()); }
+
+    // Returns the last newline in [first, last), or last.
+    static const char_type* 
+    find_last_newline(const char_type* first, const char_type* last)
+    {
+        for (const char_type* p = last; p != first; )
+            if (traits_type::eq(*--p, traits_type::newline()))
+                return p;
+        return last;
+    }
+
+    // Filters the line [first, last), followed by a newline if the line was
+    // terminated and newlines are not suppressed.
+    void filter_line(const char_type* first, const char_type* last, bool nl)
+    {
+        do_filter( view_type(first, static_cast<std::size_t>(last - first)),
+                   out_ );
+        if (nl && (flags_ & f_suppress) == 0)
+            out_ += traits_type::newline();
+    }
+
+    // Filters the full lines [first, last).
+    void filter_lines(const char_type* first, const char_type* last)
+    {
+        do_filter_lines( 
+            view_type(first, static_cast<std::size_t>(last - first)), out_ 
+        );
+    }
+
+    // Copies filtered characters into the given buffer.
+    std::streamsize read_output(char_type* s, std::streamsize n)
+    {
+        std::streamsize result =
+            (std::min)( n, 
+                        static_cast<std::streamsize>(out_.size() - out_ptr_) );
+        traits_type::copy(s, out_.data() + out_ptr_, result);
+        out_ptr_ += static_cast<std::size_t>(result);
+        if (out_ptr_ == out_.size())
+            clear_output();
+        return result;
+    }
+
+    // Filters the full lines in the input buffer, reading from src if there
+    // are none; returns false if no input is available.
+    template<typename Source>
+    bool next_lines(Source& src)
+    {
+        if (buf_.empty())
+            buf_.resize(buffer_size_);
+        const char_type *data = &buf_[0], *first = data + ptr_, 
+                        *last = data + end_,
+                        *next = find_last_newline(first, last);
+        if (next != last) {
+            filter_lines(first, next + 1);
+            ptr_ = static_cast<std::size_t>(next + 1 - data);
+            return true;
+        }
+
+        // Move the partial line to the front of the buffer, growing the
+        // buffer if the line fills it, and read more input.
+        if (ptr_ != 0) {
+            traits_type::move(&buf_[0], &buf_[0] + ptr_, end_ - ptr_);
+            end_ -= ptr_;
+            ptr_ = 0;
+        }
+        if (end_ == buf_.size())
+            buf_.resize(2 * buf_.size());
+        std::streamsize amt =
+            iostreams::read( src, &buf_[0] + end_, 
+                             static_cast<std::streamsize>(buf_.size() - end_) );
+        if (amt == -1) {
+            flags_ |= f_eof;
+            if (end_ != 0)
+                filter_line(&buf_[0], &buf_[0] + end_, false);
+            ptr_ = end_ = 0;
+            return true;
+        }
+        end_ += static_cast<std::size_t>(amt);
+        return amt != 0;
+    }
+
+    // Appends [first, last) to the partial line held in the buffer.
+    void append(const char_type* first, const char_type* last)
+    {
+        std::size_t len = static_cast<std::size_t>(last - first);
+        if (len == 0)
+            return;
+        if (end_ + len > buf_.size())
+            buf_.resize((std::max)(2 * buf_.size(), end_ + len));
+        traits_type::copy(&buf_[0] + end_, first, len);
+        end_ += len;
+    }
+
+    // Attempts to write the filtered characters to snk; returns true if
+    // none remain.
+    template<typename Sink>
+    bool flush(Sink& snk)
+    {
+        if (out_ptr_ != out_.size()) {
+            std::streamsize amt = 
+                static_cast<std::streamsize>(out_.size() - out_ptr_);
+            std::streamsize result =
+                iostreams::write_if(snk, out_.data() + out_ptr_, amt);
+            out_ptr_ += static_cast<std::size_t>(result);
+            if (result != amt)
+                return false;
+        }
+        clear_output();
+        return true;
+    }
+
+    void clear_output()
+    {
+        out_.erase();
+        out_ptr_ = 0;
+    }
+
+    void close_impl()
+    {
+        clear_output();
+        ptr_ = end_ = 0;
+        flags_ &= f_suppress;
+    }
+
+    enum flag_type {
+        f_read      = 1,
+        f_write     = f_read << 1,
+        f_suppress  = f_write << 1,
+        f_eof       = f_suppress << 1
+    };
+
+    std::vector<Ch, Alloc>  buf_;      // Unfiltered input.
+    std::size_t             buffer_size_;
+    std::size_t             ptr_;
+    std::size_t             end_;
+    string_type             out_;      // Filtered output.
+    std::size_t             out_ptr_;
+    int                     flags_;
+};
+BOOST_IOSTREAMS_PIPABLE(basic_line_view_filter, 2)
+
+typedef basic_line_view_filter<char>     line_view_filter;
+typedef basic_line_view_filter<wchar_t>  wline_view_filter;
+
 } } // End namespaces iostreams, boost.
 
 #include <boost/iostreams/detail/config/enable_warnings.hpp>
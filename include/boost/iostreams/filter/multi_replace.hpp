@@ -0,0 +1,370 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Contains the definition of the class template basic_multi_replace_filter,
+// which replaces occurrences of a set of literal strings using an
+// Aho-Corasick automaton, without buffering the whole stream.
+
+#ifndef BOOST_IOSTREAMS_MULTI_REPLACE_FILTER_HPP_INCLUDED
+#define BOOST_IOSTREAMS_MULTI_REPLACE_FILTER_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <algorithm>                          // min.
+#include <cstddef>                            // size_t.
+#include <memory>                             // allocator.
+#include <string>
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/config.hpp>                   // BOOST_DEDUCED_TYPENAME.
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/char_traits.hpp>
+#include <boost/iostreams/constants.hpp>      // default_device_buffer_size.
+#include <boost/iostreams/detail/aho_corasick.hpp>
+#include <boost/iostreams/detail/char_traits.hpp>
+#include <boost/iostreams/detail/ios.hpp>     // openmode, streamsize.
+#include <boost/iostreams/operations.hpp>     // read, write.
+#include <boost/iostreams/pipeline.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+//
+// Template name: basic_multi_replace_filter.
+// Template parameters:
+//      Ch - The character type.
+//      Alloc - The allocator type.
+// Description: DualUseFilter which replaces each occurrence of a set of
+//      literal patterns with a corresponding replacement. Where matches
+//      overlap, the one beginning first is chosen, and of those beginning
+//      at the same position, the longest. Only the characters which might
+//      begin a match are retained between calls, so memory use is bounded
+//      by the length of the longest pattern.
+//
+template<typename Ch, typename Alloc = std::allocator<Ch> >
+class basic_multi_replace_filter {
+public:
+    typedef Ch                                   char_type;
+    typedef std::basic_string<Ch>                string_type;
+    struct category
+        : dual_use,
+          filter_tag,
+          multichar_tag,
+          closable_tag
+        { };
+    basic_multi_replace_filter()
+        : automaton_(new automaton_type), ptr_(0), state_(0)
+        { }
+
+    // Constructs a filter from a range of (pattern, replacement) pairs,
+    // such as a std::map.
+    template<typename Range>
+    explicit basic_multi_replace_filter(const Range& replacements)
+        : automaton_(new automaton_type), ptr_(0), state_(0)
+    {
+        typedef typename Range::const_iterator iterator;
+        for ( iterator it = replacements.begin();
+              it != replacements.end();
+              ++it )
+        {
+            automaton_->add(it->first, it->second);
+        }
+    }
+
+    // Adds a pattern; filters copied from this one are not affected.
+    void add(const string_type& pattern, const string_type& replacement)
+    {
+        if (!automaton_.unique())
+            automaton_.reset(new automaton_type(*automaton_));
+        automaton_->add(pattern, replacement);
+    }
+
+    template<typename Source>
+    std::streamsize read(Source& src, char_type* s, std::streamsize n)
+    {
+        BOOST_ASSERT(!(state_ & f_write));
+        state_ |= f_read;
+        read_emitter emit(s, n, out_);
+
+        // Return output left over from the previous call.
+        std::streamsize amt =
+            (std::min)(n, static_cast<std::streamsize>(out_.size() - ptr_));
+        if (amt) {
+            traits_type::copy(s, &out_[ptr_], amt);
+            ptr_ += static_cast<size_type>(amt);
+            emit.result_ = amt;
+        }
+        if (ptr_ == out_.size()) {
+            out_.clear();
+            ptr_ = 0;
+        }
+
+        while (emit.result_ < n && !(state_ & f_eof)) {
+            if (in_.empty())
+                in_.resize(default_device_buffer_size);
+            std::streamsize result =
+                iostreams::read( src, &in_[0],
+                                 static_cast<std::streamsize>(in_.size()) );
+            if (result == -1) {
+                finish(emit);
+                state_ |= f_eof;
+            } else if (result == 0) {
+                break;
+            } else {
+                process(&in_[0], &in_[0] + result, emit);
+            }
+        }
+        return emit.result_ != 0 || !(state_ & f_eof) || !out_.empty() ?
+            emit.result_ :
+            -1;
+    }
+
+    template<typename Sink>
+    std::streamsize write(Sink& snk, const char_type* s, std::streamsize n)
+    {
+        BOOST_ASSERT(!(state_ & f_read));
+        state_ |= f_write;
+        if (!flush(snk))
+            return 0;
+        write_emitter<Sink> emit(snk, out_);
+        process(s, s + n, emit);
+        return n;
+    }
+
+    template<typename Sink>
+    void close(Sink& snk, BOOST_IOS::openmode which)
+    {
+        if ((state_ & f_read) != 0 && which == BOOST_IOS::in)
+            close_impl();
+        if ((state_ & f_write) != 0 && which == BOOST_IOS::out) {
+            try {
+                write_emitter<Sink> emit(snk, out_);
+                finish(emit);
+                while (!flush(snk)) ;
+            } catch (...) {
+                close_impl();
+                throw;
+            }
+            close_impl();
+        }
+    }
+private:
+    typedef detail::aho_corasick<Ch>              automaton_type;
+    typedef BOOST_IOSTREAMS_CHAR_TRAITS(Ch)       traits_type;
+    typedef std::vector<Ch, Alloc>                vector_type;
+    typedef typename vector_type::size_type       size_type;
+
+    // Copies output into the caller's buffer, retaining any excess.
+    struct read_emitter {
+        read_emitter(char_type* s, std::streamsize n, vector_type& out)
+            : s_(s), n_(n), result_(0), out_(out)
+            { }
+        void operator()(const char_type* first, const char_type* last)
+        {
+            std::streamsize amt =
+                (std::min)( n_ - result_,
+                            static_cast<std::streamsize>(last - first) );
+            traits_type::copy(s_ + result_, first, amt);
+            result_ += amt;
+            out_.insert(out_.end(), first + amt, last);
+        }
+        char_type*       s_;
+        std::streamsize  n_;
+        std::streamsize  result_;
+        vector_type&     out_;
+    };
+
+    // Writes output to the sink, retaining whatever it does not accept.
+    template<typename Sink>
+    struct write_emitter {
+        typedef typename iostreams::category_of<Sink>::type  category;
+        typedef is_convertible<category, output>             can_write;
+        write_emitter(Sink& snk, vector_type& out) : snk_(snk), out_(out) { }
+        void operator()(const char_type* first, const char_type* last)
+        {
+            if (first != last)
+                write(first, last, can_write());
+        }
+        void write(const char_type* first, const char_type* last, mpl::true_)
+        {
+            if (out_.empty())
+                first += iostreams::write( snk_, first,
+                                           static_cast<std::streamsize>(
+                                               last - first
+                                           ) );
+            out_.insert(out_.end(), first, last);
+        }
+        void write(const char_type*, const char_type*, mpl::false_) { }
+        Sink&         snk_;
+        vector_type&  out_;
+    };
+
+    // Attempts to write retained output to the given sink; returns true if
+    // none remains.
+    template<typename Sink>
+    bool flush(Sink& snk)
+    {
+        typedef typename iostreams::category_of<Sink>::type  category;
+        typedef is_convertible<category, output>             can_write;
+        return flush(snk, can_write());
+    }
+
+    template<typename Sink>
+    bool flush(Sink& snk, mpl::true_)
+    {
+        if (ptr_ != out_.size())
+            ptr_ += static_cast<size_type>(
+                iostreams::write( snk, &out_[ptr_],
+                                  static_cast<std::streamsize>(
+                                      out_.size() - ptr_
+                                  ) )
+            );
+        if (ptr_ != out_.size())
+            return false;
+        out_.clear();
+        ptr_ = 0;
+        return true;
+    }
+
+    template<typename Sink>
+    bool flush(Sink&, mpl::false_) { return true; }
+
+    const automaton_type& automaton()
+    {
+        if (!automaton_->compiled()) {
+            if (!automaton_.unique())
+                automaton_.reset(new automaton_type(*automaton_));
+            automaton_->compile();
+        }
+        return *automaton_;
+    }
+
+    // Filters [first, last), writing output to emit and retaining the
+    // characters whose fate depends on input not yet seen.
+    template<typename Emitter>
+    void process(const char_type* first, const char_type* last, Emitter& emit)
+    {
+        std::size_t max_length = automaton().max_length();
+        if (!window_.empty()) {
+
+            // Rescan the retained characters followed by enough new input to
+            // decide all matches beginning among them.
+            std::size_t size = window_.size();
+            std::size_t amt =
+                (std::min)(static_cast<std::size_t>(last - first), max_length);
+            window_.insert(window_.end(), first, first + amt);
+            const char_type* begin = &window_[0];
+            std::size_t off = static_cast<std::size_t>(
+                scan(begin, begin + window_.size(), false, emit) - begin
+            );
+            if (amt == max_length && first + amt != last) {
+                BOOST_ASSERT(off >= size);
+                first += off - size;
+                window_.clear();
+            } else {
+                window_.erase(window_.begin(), window_.begin() + off);
+                return;
+            }
+        }
+        const char_type* next = scan(first, last, false, emit);
+        window_.assign(next, last);
+    }
+
+    template<typename Emitter>
+    void finish(Emitter& emit)
+    {
+        if (!window_.empty()) {
+            const char_type* begin = &window_[0];
+            scan(begin, begin + window_.size(), true, emit);
+            window_.clear();
+        }
+    }
+
+    // Scans [first, last) from the initial state, writing output to emit,
+    // and returns the first character which cannot be resolved without
+    // further input; if eof is true, returns last.
+    template<typename Emitter>
+    const char_type* scan( const char_type* first, const char_type* last,
+                           bool eof, Emitter& emit )
+    {
+        const automaton_type& ac = automaton();
+        const char_type*  verbatim = first;
+        const char_type*  p = first;
+        const char_type*  best_start = 0;
+        const char_type*  best_end = 0;
+        int               best = -1;
+        int               s = 0;
+        while (true) {
+            if (s == 0 && best == -1)
+                p = ac.skip(p, last);
+            if (p != last) {
+                s = ac.next(s, *p++);
+                int len = ac.match_length(s);
+                if (len != 0 && (best == -1 || p - len <= best_start)) {
+                    best = s;
+                    best_start = p - len;
+                    best_end = p;
+                }
+                if (best == -1 || p - ac.depth(s) <= best_start)
+                    continue;
+            } else if (!eof || best == -1) {
+                break;
+            }
+
+            // No match beginning at or before best_start remains possible.
+            const string_type& replacement = ac.replacement(best);
+            emit(verbatim, best_start);
+            if (!replacement.empty())
+                emit( replacement.data(),
+                      replacement.data() + replacement.size() );
+            verbatim = p = best_end;
+            best = -1;
+            s = 0;
+        }
+        // Any pending match lies within the characters recognized by s.
+        const char_type* next = eof ? last : p - ac.depth(s);
+        emit(verbatim, next);
+        return next;
+    }
+
+    void close_impl()
+    {
+        window_.clear();
+        out_.clear();
+        ptr_ = 0;
+        state_ = 0;
+    }
+
+    enum flag_type {
+        f_read   = 1,
+        f_write  = f_read << 1,
+        f_eof    = f_write << 1
+    };
+
+    shared_ptr<automaton_type>  automaton_;
+    vector_type                 window_;
+    vector_type                 in_;
+    vector_type                 out_;
+    size_type                   ptr_;
+    int                         state_;
+};
+BOOST_IOSTREAMS_PIPABLE(basic_multi_replace_filter, 2)
+
+typedef basic_multi_replace_filter<char>     multi_replace_filter;
+typedef basic_multi_replace_filter<wchar_t>  wmulti_replace_filter;
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>  // MSVC.
+
+#endif // #ifndef BOOST_IOSTREAMS_MULTI_REPLACE_FILTER_HPP_INCLUDED
@@ -5,9 +5,6 @@
 
 // See http://www.boost.org/libs/iostreams for documentation.
 
-// NOTE: I hope to replace the current implementation with a much simpler
-// one.
-
 #ifndef BOOST_IOSTREAMS_NEWLINE_FILTER_HPP_INCLUDED
 #define BOOST_IOSTREAMS_NEWLINE_FILTER_HPP_INCLUDED
 
@@ -16,16 +13,21 @@
 #endif
 
 #include <boost/assert.hpp>
+#include <algorithm>                       // min.
+#include <cstddef>                         // size_t.
 #include <cstdio>
+#include <cstring>                         // memcpy.
 #include <stdexcept>                       // logic_error.
+#include <vector>
 #include <boost/config.hpp>                // BOOST_STATIC_CONSTANT.
 #include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/constants.hpp>   // default_device_buffer_size.
 #include <boost/iostreams/detail/char_traits.hpp>
 #include <boost/iostreams/detail/ios.hpp>  // BOOST_IOSTREAMS_FAILURE 
-#include <boost/iostreams/read.hpp>        // get 
-#include <boost/iostreams/write.hpp>       // put 
+#include <boost/iostreams/detail/scan.hpp> // find_char, find_either.
+#include <boost/iostreams/read.hpp>        // read, get 
+#include <boost/iostreams/write.hpp>       // write, put 
 #include <boost/iostreams/pipeline.hpp>
-#include <boost/iostreams/putback.hpp>
 #include <boost/mpl/bool.hpp>
 #include <boost/throw_exception.hpp>
 #include <boost/type_traits/is_convertible.hpp>
@@ -33,9 +35,6 @@
 // Must come last.
 #include <boost/iostreams/detail/config/disable_warnings.hpp>
 
-#define BOOST_IOSTREAMS_ASSERT_UNREACHABLE(val) \
-    (BOOST_ASSERT("unreachable code" == 0), val) \
-    /**/
 
 namespace boost { namespace iostreams {
 
@@ -110,16 +109,25 @@ private:
         { }
 };
 
+//
+// Class name: newline_filter.
+// Description: Converts CR, LF and CR-LF line endings to those of a target
+//      platform. Runs of characters between line endings are located a
+//      buffer at a time, using vector instructions where the target supports
+//      them, and copied in bulk. A CR at the end of one buffer is translated
+//      at once; an LF which begins the next buffer is then dropped.
+//
 class newline_filter {
 public:
     typedef char char_type;
     struct category
         : dual_use,
           filter_tag,
+          multichar_tag,
           closable_tag
         { };
 
-    explicit newline_filter(int target) : flags_(target)
+    explicit newline_filter(int target) : flags_(target), ptr_(0), eptr_(0)
     {
         if ( target != iostreams::newline::posix &&
              target != iostreams::newline::dos &&
@@ -130,122 +138,167 @@ public:
     }
 
     template<typename Source>
-    int get(Source& src)
+    std::streamsize read(Source& src, char* s, std::streamsize n)
     {
-        using iostreams::newline::CR;
         using iostreams::newline::LF;
 
         BOOST_ASSERT((flags_ & f_write) == 0);
         flags_ |= f_read;
 
-        if (flags_ & (f_has_LF | f_has_EOF)) {
-            if (flags_ & f_has_LF)
-                return newline();
-            else
-                return EOF;
-        }
-
-        int c =
-            (flags_ & f_has_CR) == 0 ?
-                iostreams::get(src) :
-                CR;
-
-        if (c == WOULD_BLOCK )
-            return WOULD_BLOCK;
-
-        if (c == CR) {
-            flags_ |= f_has_CR;
-
-            int d = iostreams::get(src);
-            if (d == WOULD_BLOCK)
-                return WOULD_BLOCK;
-
-            if (d == LF) {
-                flags_ &= ~f_has_CR;
-                return newline();
+        char *next = s, *end = s + n;
+        while (next != end) {
+            if ((flags_ & f_has_LF) != 0) {
+                *next++ = LF;
+                flags_ &= ~f_has_LF;
+                continue;
             }
-
-            if (d == EOF) {
-                flags_ |= f_has_EOF;
-            } else {
-                iostreams::putback(src, d);
+            if (ptr_ == eptr_ && !fill(src, n))
+                break;
+
+            // Translate buffered characters until the buffer is exhausted
+            // or a newline sequence does not fit.
+            const char* first = &buf_[0] + ptr_;
+            const char* last = &buf_[0] + eptr_;
+            while (first != last && next != end && (flags_ & f_has_LF) == 0) {
+                if ((flags_ & f_skip_LF) != 0) {
+                    flags_ &= ~f_skip_LF;
+                    if (*first == LF) {
+                        ++first;
+                        continue;
+                    }
+                }
+                const char* limit =
+                    first + (std::min)(last - first, end - next);
+                const char* p = find_newline(first, limit);
+                std::memcpy(next, first, static_cast<std::size_t>(p - first));
+                next += p - first;
+                first = p;
+                if (p != limit)
+                    next = newline(next, end, *first++);
             }
-
-            flags_ &= ~f_has_CR;
-            return newline();
+            ptr_ = static_cast<std::size_t>(first - &buf_[0]);
         }
-
-        if (c == LF)
-            return newline();
-
-        return c;
+        return next != s || (flags_ & f_has_EOF) == 0 || ptr_ != eptr_ ?
+            static_cast<std::streamsize>(next - s) :
+            -1;
     }
 
     template<typename Sink>
-    bool put(Sink& dest, char c)
+    std::streamsize write(Sink& dest, const char* s, std::streamsize n)
     {
-        using iostreams::newline::CR;
         using iostreams::newline::LF;
 
         BOOST_ASSERT((flags_ & f_read) == 0);
         flags_ |= f_write;
 
-        if ((flags_ & f_has_LF) != 0)
-            return c == LF ?
-                newline(dest) :
-                newline(dest) && this->put(dest, c);
-
-        if (c == LF)
-           return newline(dest);
-
-        if ((flags_ & f_has_CR) != 0)
-            return newline(dest) ?
-                this->put(dest, c) :
-                false;
+        const char *first = s, *last = s + n;
+        while (first != last) {
+            if ((flags_ & f_has_LF) != 0) {
+                if (!iostreams::put(dest, LF))
+                    break;
+                flags_ &= ~f_has_LF;
+            }
+            if ((flags_ & f_skip_LF) != 0) {
+                flags_ &= ~f_skip_LF;
+                if (*first == LF) {
+                    ++first;
+                    continue;
+                }
+            }
 
-        if (c == CR) {
-            flags_ |= f_has_CR;
-            return true;
+            // Copy the characters preceding the next newline directly to
+            // dest.
+            const char* p = find_newline(first, last);
+            if (p != first) {
+                first += iostreams::write(dest, first, p - first);
+                if (first != p)
+                    break;
+            }
+            if (p == last || !newline(dest, *p))
+                break;
+            ++first;
         }
-
-        return iostreams::put(dest, c);
+        return static_cast<std::streamsize>(first - s);
     }
 
     template<typename Sink>
     void close(Sink& dest, BOOST_IOS::openmode)
     {
-        if ((flags_ & f_write) != 0 && (flags_ & f_has_CR) != 0)
+        if ((flags_ & f_write) != 0 && (flags_ & f_has_LF) != 0)
             newline_if_sink(dest);
-        flags_ &= ~f_has_LF; // Restore original flags.
+        flags_ &= iostreams::newline::platform_mask; // Restore original flags.
+        ptr_ = eptr_ = 0;
     }
 private:
 
-    // Returns the appropriate element of a newline sequence.
-    int newline()
+    // Reads at most n characters from src into the input buffer; returns
+    // false if none are available.
+    template<typename Source>
+    bool fill(Source& src, std::streamsize n)
+    {
+        if ((flags_ & f_has_EOF) != 0)
+            return false;
+        if (buf_.empty())
+            buf_.resize(default_device_buffer_size);
+        std::streamsize amt =
+            iostreams::read( src, &buf_[0],
+                             (std::min)( n, static_cast<std::streamsize>(
+                                                buf_.size()
+                                            ) ) );
+        if (amt <= 0) {
+            if (amt == -1)
+                flags_ |= f_has_EOF;
+            return false;
+        }
+        ptr_ = 0;
+        eptr_ = static_cast<std::size_t>(amt);
+        return true;
+    }
+
+    // Returns the first character in [first, last) which begins a newline
+    // sequence, or last. LF needs no translation for a posix target.
+    const char* find_newline(const char* first, const char* last) const
     {
         using iostreams::newline::CR;
         using iostreams::newline::LF;
 
+        return (flags_ & iostreams::newline::posix) != 0 ?
+            detail::find_char(first, last, CR) :
+            detail::find_either(first, last, CR, LF);
+    }
+
+    // Writes the newline sequence replacing c to the non-empty range
+    // [s, end) and returns the end of the output; the LF of a CR-LF sequence
+    // which does not fit is held back.
+    char* newline(char* s, char* end, char c)
+    {
+        using iostreams::newline::CR;
+        using iostreams::newline::LF;
+
+        if (c == CR)
+            flags_ |= f_skip_LF;
         switch (flags_ & iostreams::newline::platform_mask) {
         case iostreams::newline::posix:
-            return LF;
+            *s++ = LF;
+            break;
         case iostreams::newline::mac:
-            return CR;
+            *s++ = CR;
+            break;
         case iostreams::newline::dos:
-            if (flags_ & f_has_LF) {
-                flags_ &= ~f_has_LF;
-                return LF;
-            } else {
+            *s++ = CR;
+            if (s != end)
+                *s++ = LF;
+            else
                 flags_ |= f_has_LF;
-                return CR;
-            }
+            break;
         }
-        return BOOST_IOSTREAMS_ASSERT_UNREACHABLE(0);
+        return s;
     }
 
-    // Writes a newline sequence.
+    // Writes the newline sequence replacing c; returns false if nothing
+    // was written.
     template<typename Sink>
-    bool newline(Sink& dest)
+    bool newline(Sink& dest, char c)
     {
         using iostreams::newline::CR;
         using iostreams::newline::LF;
@@ -259,23 +312,21 @@ private:
             success = boost::iostreams::put(dest, CR);
             break;
         case iostreams::newline::dos:
-            if ((flags_ & f_has_LF) != 0) {
-                success = boost::iostreams::put(dest, LF);
-                if (success)
-                    flags_ &= ~f_has_LF;
-            } else if (boost::iostreams::put(dest, CR)) {
-                success = boost::iostreams::put(dest, LF);
-                if (!success)
+            {
+                const char seq[2] = { CR, LF };
+                std::streamsize amt = boost::iostreams::write(dest, seq, 2);
+                success = amt != 0;
+                if (amt == 1)
                     flags_ |= f_has_LF;
             }
             break;
         }
-        if (success)
-            flags_ &= ~f_has_CR;
+        if (success && c == CR)
+            flags_ |= f_skip_LF;
         return success;
     }
 
-    // Writes a newline sequence if the given device is a Sink.
+    // Writes a held-back LF if the given device is a Sink.
     template<typename Device>
     void newline_if_sink(Device& dest) 
     { 
@@ -284,20 +335,23 @@ private:
     }
 
     template<typename Sink>
-    void newline_if_sink(Sink& dest, mpl::true_) { newline(dest); }
+    void newline_if_sink(Sink& dest, mpl::true_) 
+    { iostreams::put(dest, iostreams::newline::LF); }
 
     template<typename Source>
     void newline_if_sink(Source&, mpl::false_) { }
 
     enum flags {
         f_has_LF         = 32768,
-        f_has_CR         = f_has_LF << 1,
-        f_has_newline    = f_has_CR << 1,
-        f_has_EOF        = f_has_newline << 1,
+        f_skip_LF        = f_has_LF << 1,
+        f_has_EOF        = f_skip_LF << 1,
         f_read           = f_has_EOF << 1,
         f_write          = f_read << 1
     };
-    int       flags_;
+    int                flags_;
+    std::vector<char>  buf_;    // Input buffer, used when reading.
+    std::size_t        ptr_;
+    std::size_t        eptr_;
 };
 BOOST_IOSTREAMS_PIPABLE(newline_filter, 0)
 
@@ -306,97 +360,52 @@ public:
     typedef char                 char_type;
     struct category
         : dual_use_filter_tag,
+          multichar_tag,
           closable_tag
         { };
     explicit newline_checker(int target = newline::mixed)
         : detail::newline_base(0), target_(target), open_(false)
         { }
     template<typename Source>
-    int get(Source& src)
+    std::streamsize read(Source& src, char* s, std::streamsize n)
     {
-        using newline::CR;
-        using newline::LF;
-
         if (!open_) {
             open_ = true;
             source() = 0;
         }
 
-        int c;
-        if ((c = iostreams::get(src)) == WOULD_BLOCK)
-            return WOULD_BLOCK;
+        std::streamsize amt = iostreams::read(src, s, n);
+        if (amt != -1) {
+            scan(s, s + amt);
+            return amt;
+        }
 
         // Update source flags.
-        if (c != EOF)
-            source() &= ~f_line_complete;
-        if ((source() & f_has_CR) != 0) {
-            if (c == LF) {
-                source() |= newline::dos;
-                source() |= f_line_complete;
-            } else {
-                source() |= newline::mac;
-                if (c == EOF)
-                    source() |= f_line_complete;
-            }
-        } else if (c == LF) {
-            source() |= newline::posix;
-            source() |= f_line_complete;
-        }
-        source() = (source() & ~f_has_CR) | (c == CR ? f_has_CR : 0);
+        if ((source() & f_has_CR) != 0)
+            source() |= newline::mac | f_line_complete;
+        source() &= ~f_has_CR;
 
         // Check for errors.
-        if ( c == EOF &&
-            (target_ & newline::final_newline) != 0 &&
-            (source() & f_line_complete) == 0 )
-        {
-            fail();
-        }
-        if ( (target_ & newline::platform_mask) != 0 &&
-             (source() & ~target_ & newline::platform_mask) != 0 )
+        if ( (target_ & newline::final_newline) != 0 &&
+             (source() & f_line_complete) == 0 )
         {
             fail();
         }
-
-        return c;
+        check();
+        return -1;
     }
 
     template<typename Sink>
-    bool put(Sink& dest, int c)
+    std::streamsize write(Sink& dest, const char* s, std::streamsize n)
     {
-        using iostreams::newline::CR;
-        using iostreams::newline::LF;
-
         if (!open_) {
             open_ = true;
             source() = 0;
         }
 
-        if (!iostreams::put(dest, c))
-            return false;
-
-         // Update source flags.
-        source() &= ~f_line_complete;
-        if ((source() & f_has_CR) != 0) {
-            if (c == LF) {
-                source() |= newline::dos;
-                source() |= f_line_complete;
-            } else {
-                source() |= newline::mac;
-            }
-        } else if (c == LF) {
-            source() |= newline::posix;
-            source() |= f_line_complete;
-        }
-        source() = (source() & ~f_has_CR) | (c == CR ? f_has_CR : 0);
-
-        // Check for errors.
-        if ( (target_ & newline::platform_mask) != 0 &&
-             (source() & ~target_ & newline::platform_mask) != 0 )
-        {
-            fail();
-        }
-
-        return true;
+        std::streamsize amt = iostreams::write(dest, s, n);
+        scan(s, s + amt);
+        return amt;
     }
 
     template<typename Sink>
@@ -422,6 +431,54 @@ public:
         }
     }
 private:
+
+    // Records the line endings in [first, last), which may begin with the
+    // LF of a CR-LF sequence whose CR was seen previously.
+    void scan(const char* first, const char* last)
+    {
+        using newline::CR;
+        using newline::LF;
+
+        if (first == last)
+            return;
+
+        // Update source flags.
+        const char* p = first;
+        if ((source() & f_has_CR) != 0) {
+            if (*p == LF) {
+                source() |= newline::dos;
+                ++p;
+            } else {
+                source() |= newline::mac;
+            }
+        }
+        source() &= ~(f_has_CR | f_line_complete);
+        while ((p = detail::find_either(p, last, CR, LF)) != last) {
+            if (*p++ == LF) {
+                source() |= newline::posix;
+            } else if (p == last) {
+                source() |= f_has_CR;
+            } else if (*p == LF) {
+                source() |= newline::dos;
+                ++p;
+            } else {
+                source() |= newline::mac;
+            }
+        }
+        if (last[-1] == LF)
+            source() |= f_line_complete;
+
+        // Check for errors.
+        check();
+    }
+    void check()
+    {
+        if ( (target_ & newline::platform_mask) != 0 &&
+             (source() & ~target_ & newline::platform_mask) != 0 )
+        {
+            fail();
+        }
+    }
     void fail() { boost::throw_exception(newline_error(source())); }
     int& source() { return flags_; }
     int source() const { return flags_; }
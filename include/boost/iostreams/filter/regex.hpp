@@ -12,11 +12,24 @@
 # pragma once
 #endif              
 
+#include <algorithm>                      // min.
+#include <cstddef>                        // ptrdiff_t.
 #include <memory>                         // allocator.
+#include <stdexcept>                      // invalid_argument.
+#include <vector>
+#include <boost/assert.hpp>
 #include <boost/function.hpp>        
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/char_traits.hpp>
+#include <boost/iostreams/constants.hpp>  // default_device_buffer_size.
+#include <boost/iostreams/detail/ios.hpp> // openmode, streamsize.
 #include <boost/iostreams/filter/aggregate.hpp>              
+#include <boost/iostreams/operations.hpp> // read, write.
 #include <boost/iostreams/pipeline.hpp>                
+#include <boost/mpl/bool.hpp>
 #include <boost/regex.hpp>
+#include <boost/throw_exception.hpp>
+#include <boost/type_traits/is_convertible.hpp>
 
 namespace boost { namespace iostreams {
 
@@ -92,6 +105,286 @@ BOOST_IOSTREAMS_PIPABLE(basic_regex_filter, 3)
 typedef basic_regex_filter<char>     regex_filter;
 typedef basic_regex_filter<wchar_t>  wregex_filter;
 
+//
+// Template name: basic_streaming_regex_filter.
+// Template parameters:
+//      Ch - The character type.
+//      Tr - The regular expression traits type.
+//      Alloc - The allocator type.
+// Description: DualUseFilter which performs the same substitutions as
+//      basic_regex_filter while retaining only a bounded window of input.
+//      A match is taken to be final once at least window characters
+//      following its first character are available, so a match longer
+//      than the window may be cut short, or missed entirely if no prefix of
+//      it matches the pattern. Up to window characters preceding the
+//      unresolved input are retained as context for assertions such as \b
+//      and lookbehind. The window must be positive.
+//
+template< typename Ch,
+          typename Tr = regex_traits<Ch>,
+          typename Alloc = std::allocator<Ch> >
+class basic_streaming_regex_filter {
+public:
+    typedef Ch                                         char_type;
+    struct category
+        : dual_use,
+          filter_tag,
+          multichar_tag,
+          closable_tag
+        { };
+    typedef std::basic_string<Ch>                      string_type;
+    typedef basic_regex<Ch, Tr>                        regex_type;
+    typedef regex_constants::match_flag_type           flag_type;
+    typedef match_results<const Ch*>                   match_type;
+    typedef function1<string_type, const match_type&>  formatter;
+
+    basic_streaming_regex_filter( 
+        const regex_type& re,
+        const formatter& replace,
+        std::streamsize window = default_device_buffer_size,
+        flag_type flags = regex_constants::match_default )
+        : re_(re), replace_(replace), flags_(flags), 
+          window_(checked_window(window))
+        { init(); }
+    basic_streaming_regex_filter( 
+        const regex_type& re,
+        const string_type& fmt,
+        std::streamsize window = default_device_buffer_size,
+        flag_type flags = regex_constants::match_default,
+        flag_type fmt_flags = regex_constants::format_default )
+        : re_(re), replace_(simple_formatter(fmt, fmt_flags)), flags_(flags),
+          window_(checked_window(window))
+        { init(); }
+    basic_streaming_regex_filter( 
+        const regex_type& re,
+        const char_type* fmt,
+        std::streamsize window = default_device_buffer_size,
+        flag_type flags = regex_constants::match_default,
+        flag_type fmt_flags = regex_constants::format_default )
+        : re_(re), replace_(simple_formatter(fmt, fmt_flags)), flags_(flags),
+          window_(checked_window(window))
+        { init(); }
+    std::streamsize window() const 
+    { return static_cast<std::streamsize>(window_); }
+
+    template<typename Source>
+    std::streamsize read(Source& src, char_type* s, std::streamsize n)
+    {
+        BOOST_ASSERT(!(state_ & f_write));
+        state_ |= f_read;
+        std::streamsize result = 0;
+        while (true) {
+            std::streamsize amt =
+                (std::min)( n - result, 
+                            static_cast<std::streamsize>(out_.size() - ptr_) );
+            if (amt) {
+                traits_type::copy(s + result, &out_[ptr_], amt);
+                ptr_ += static_cast<size_type>(amt);
+                result += amt;
+            }
+            if (ptr_ == out_.size()) {
+                out_.clear();
+                ptr_ = 0;
+            }
+            if (result == n || (state_ & f_eof) != 0)
+                break;
+
+            // Read more input.
+            size_type size = buf_.size();
+            buf_.resize(size + default_device_buffer_size);
+            amt = iostreams::read( src, &buf_[size], 
+                                   default_device_buffer_size );
+            buf_.resize(size + (amt == -1 ? 0 : static_cast<size_type>(amt)));
+            if (amt == -1) {
+                filter(true);
+                state_ |= f_eof;
+            } else if (amt == 0) {
+                break;
+            } else {
+                filter(false);
+            }
+        }
+        return result != 0 || (state_ & f_eof) == 0 ? result : -1;
+    }
+
+    template<typename Sink>
+    std::streamsize write(Sink& snk, const char_type* s, std::streamsize n)
+    {
+        BOOST_ASSERT(!(state_ & f_read));
+        state_ |= f_write;
+        if (!flush(snk))
+            return 0;
+        buf_.insert(buf_.end(), s, s + n);
+        filter(false);
+        flush(snk);
+        return n;
+    }
+
+    template<typename Sink>
+    void close(Sink& snk, BOOST_IOS::openmode which)
+    {
+        if ((state_ & f_read) != 0 && which == BOOST_IOS::in)
+            close_impl();
+        if ((state_ & f_write) != 0 && which == BOOST_IOS::out) {
+            try {
+                filter(true);
+                while (!flush(snk)) ;
+            } catch (...) {
+                close_impl();
+                throw;
+            }
+            close_impl();
+        }
+    }
+private:
+    typedef BOOST_IOSTREAMS_CHAR_TRAITS(Ch)  traits_type;
+    typedef std::vector<Ch, Alloc>           vector_type;
+    typedef typename vector_type::size_type  size_type;
+    struct simple_formatter {
+        simple_formatter(const string_type& fmt, flag_type fmt_flags) 
+            : fmt_(fmt), fmt_flags_(fmt_flags) { }
+        string_type operator() (const match_type& match) const
+        { return match.format(fmt_, fmt_flags_); }
+        string_type  fmt_;
+        flag_type    fmt_flags_;
+    };
+
+    static size_type checked_window(std::streamsize window)
+    {
+        if (window <= 0)
+            boost::throw_exception(std::invalid_argument("bad window size"));
+        return static_cast<size_type>(window);
+    }
+
+    void init()
+    {
+        context_ = ptr_ = 0;
+        null_ = false;
+        state_ = 0;
+    }
+
+    // Appends to out_ the result of filtering the buffered input, except 
+    // for the final window characters, unless eof is true.
+    void filter(bool eof)
+    {
+        if (buf_.empty())
+            return;
+        const Ch*  begin = &buf_[0];
+        const Ch*  end = begin + buf_.size();
+        const Ch*  pos = begin + context_;
+
+        // Offset from begin of the last position at which a match may be
+        // considered final; may be negative.
+        std::ptrdiff_t limit = 
+            static_cast<std::ptrdiff_t>(buf_.size()) -
+            (eof ? 0 : static_cast<std::ptrdiff_t>(window_));
+        match_type m;
+        while (true) {
+            flag_type flags = flags_;
+            if (pos != begin)
+                flags |= regex_constants::match_prev_avail;
+
+            // As with regex_iterator, an empty match may be followed only 
+            // by a non-empty match at the same position.
+            bool found = null_ ?
+                regex_search( pos, end, m, re_, 
+                              flags | regex_constants::match_not_null | 
+                                  regex_constants::match_continuous ) :
+                regex_search(pos, end, m, re_, flags);
+            if (found && m[0].first - begin <= limit) {
+                out_.insert(out_.end(), pos, m[0].first);
+                string_type replacement = replace_(m);
+                out_.insert(out_.end(), replacement.begin(), replacement.end());
+                null_ = m[0].first == m[0].second;
+                pos = m[0].second;
+            } else if (null_ && pos - begin <= limit && pos != end) {
+                out_.push_back(*pos++);
+                null_ = false;
+            } else {
+                break;
+            }
+        }
+        if (eof) {
+            out_.insert(out_.end(), pos, end);
+            buf_.clear();
+            context_ = 0;
+            null_ = false;
+            return;
+        }
+        if (pos - begin < limit) {
+            out_.insert(out_.end(), pos, begin + limit);
+            pos = begin + limit;
+            null_ = false;
+        }
+
+        // Discard input which is neither unresolved nor needed as context.
+        size_type off = static_cast<size_type>(pos - begin);
+        size_type keep = off > window_ ? off - window_ : 0;
+        buf_.erase(buf_.begin(), buf_.begin() + keep);
+        context_ = off - keep;
+    }
+
+    // Attempts to write filtered output to the given sink; returns true if 
+    // none remains.
+    template<typename Sink>
+    bool flush(Sink& snk)
+    {
+        typedef typename iostreams::category_of<Sink>::type  category;
+        typedef is_convertible<category, output>             can_write;
+        return flush(snk, can_write());
+    }
+
+    template<typename Sink>
+    bool flush(Sink& snk, mpl::true_)
+    {
+        if (ptr_ != out_.size())
+            ptr_ += static_cast<size_type>(
+                iostreams::write( snk, &out_[ptr_], 
+                                  static_cast<std::streamsize>(
+                                      out_.size() - ptr_
+                                  ) )
+            );
+        if (ptr_ != out_.size())
+            return false;
+        out_.clear();
+        ptr_ = 0;
+        return true;
+    }
+
+    template<typename Sink>
+    bool flush(Sink&, mpl::false_) { return true; }
+
+    void close_impl()
+    {
+        buf_.clear();
+        out_.clear();
+        context_ = ptr_ = 0;
+        null_ = false;
+        state_ = 0;
+    }
+
+    enum state_type {
+        f_read   = 1,
+        f_write  = f_read << 1,
+        f_eof    = f_write << 1
+    };
+
+    regex_type   re_;
+    formatter    replace_;
+    flag_type    flags_;
+    size_type    window_;
+    vector_type  buf_;
+    size_type    context_;  // Number of characters in buf_ already filtered.
+    vector_type  out_;
+    size_type    ptr_;
+    bool         null_;     // True if the last match was empty.
+    int          state_;
+};
+BOOST_IOSTREAMS_PIPABLE(basic_streaming_regex_filter, 3)
+
+typedef basic_streaming_regex_filter<char>     streaming_regex_filter;
+typedef basic_streaming_regex_filter<wchar_t>  wstreaming_regex_filter;
+
 
 } } // End namespaces iostreams, boost.
 
@@ -30,6 +30,30 @@ namespace boost { namespace iostreams {
 
 namespace detail {
 
+inline std::istream& standard_input(char*) { return std::cin; }
+inline std::ostream& standard_output(char*) { return std::cout; }
+#ifndef BOOST_IOSTREAMS_NO_WIDE_STREAMS
+inline std::wistream& standard_input(wchar_t*) { return std::wcin; }
+inline std::wostream& standard_output(wchar_t*) { return std::wcout; }
+#endif // BOOST_IOSTREAMS_NO_WIDE_STREAMS
+
+// Replaces the stream buffer of a standard stream for the lifetime of the
+// object.
+template<typename Ch>
+struct scoped_redirector { // Thanks to Maxim Egorushkin.
+    typedef BOOST_IOSTREAMS_CHAR_TRAITS(Ch)                  traits_type;
+    typedef BOOST_IOSTREAMS_BASIC_IOS(Ch, traits_type)       ios_type;
+    typedef BOOST_IOSTREAMS_BASIC_STREAMBUF(Ch, traits_type) streambuf_type;
+    scoped_redirector( ios_type& ios,
+                       streambuf_type* newbuf )
+        : ios_(ios), old_(ios.rdbuf(newbuf))
+        { }
+    ~scoped_redirector() { ios_.rdbuf(old_); }
+    scoped_redirector& operator=(const scoped_redirector&);
+    ios_type&        ios_;
+    streambuf_type*  old_;
+};
+
 } // End namespace detail.
 
 template<typename Ch, typename Alloc = std::allocator<Ch> >
@@ -41,26 +65,7 @@ public:
     typedef typename base_type::category     category;
     typedef typename base_type::vector_type  vector_type;
 private:
-    static std::istream& standard_input(char*) { return std::cin; }
-    static std::ostream& standard_output(char*) { return std::cout; }
-#ifndef BOOST_IOSTREAMS_NO_WIDE_STREAMS
-    static std::wistream& standard_input(wchar_t*) { return std::wcin; }
-    static std::wostream& standard_output(wchar_t*) { return std::wcout; }
-#endif // BOOST_IOSTREAMS_NO_WIDE_STREAMS
-
-    struct scoped_redirector { // Thanks to Maxim Egorushkin.
-        typedef BOOST_IOSTREAMS_CHAR_TRAITS(Ch)                  traits_type;
-        typedef BOOST_IOSTREAMS_BASIC_IOS(Ch, traits_type)       ios_type;
-        typedef BOOST_IOSTREAMS_BASIC_STREAMBUF(Ch, traits_type) streambuf_type;
-        scoped_redirector( ios_type& ios,
-                           streambuf_type* newbuf )
-            : ios_(ios), old_(ios.rdbuf(newbuf))
-            { }
-        ~scoped_redirector() { ios_.rdbuf(old_); }
-        scoped_redirector& operator=(const scoped_redirector&);
-        ios_type&        ios_;
-        streambuf_type*  old_;
-    };
+    typedef detail::scoped_redirector<Ch>    scoped_redirector;
 
     virtual void do_filter() = 0;
     virtual void do_filter(const vector_type& src, vector_type& dest)
@@ -69,8 +74,10 @@ private:
                           srcbuf(&src[0], &src[0] + src.size());
         stream_buffer< back_insert_device<vector_type> >
                           destbuf(iostreams::back_inserter(dest));
-        scoped_redirector redirect_input(standard_input((Ch*)0), &srcbuf);
-        scoped_redirector redirect_output(standard_output((Ch*)0), &destbuf);
+        scoped_redirector
+            redirect_input(detail::standard_input((Ch*)0), &srcbuf);
+        scoped_redirector
+            redirect_output(detail::standard_output((Ch*)0), &destbuf);
         do_filter();
     }
 };
@@ -0,0 +1,403 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class template basic_streaming_stdio_filter, which runs a
+// stdio-style filter on a background thread, feeding it incrementally.
+// Requires C++11 threading support.
+
+#ifndef BOOST_IOSTREAMS_STREAMING_STDIO_FILTER_HPP_INCLUDED
+#define BOOST_IOSTREAMS_STREAMING_STDIO_FILTER_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <algorithm>                              // min.
+#include <condition_variable>
+#include <cstddef>                                // size_t.
+#include <exception>                              // exception_ptr.
+#include <mutex>
+#include <thread>
+#include <vector>
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/detail/char_traits.hpp>
+#include <boost/iostreams/detail/ios.hpp>         // openmode, streamsize.
+#include <boost/iostreams/detail/iostream.hpp>
+#include <boost/iostreams/detail/spsc_ring.hpp>
+#include <boost/iostreams/filter/stdio.hpp>       // scoped_redirector.
+#include <boost/iostreams/operations.hpp>
+#include <boost/iostreams/pipeline.hpp>
+#include <boost/shared_ptr.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+//
+// Template name: basic_streaming_stdio_filter.
+// Template parameters:
+//      Ch - The character type.
+// Description: Utility for defining DualUseFilters which read their input
+//      from a standard input stream and write their output to a standard
+//      output stream, like basic_stdio_filter, but without collecting the
+//      entire input first. The filter runs on a background thread, started
+//      by the first read or write, which reads from and writes to two
+//      bounded pipes through stream buffers; the calling thread feeds the
+//      input pipe and drains the output pipe, so memory use does not depend
+//      on the length of the input. To use, override one of the private
+//      virtual members do_filter(in, out), which is given the streams, and
+//      do_filter(), which finds them in std::cin and std::cout. The default
+//      implementation of do_filter(in, out) redirects the process-wide
+//      standard streams to the pipes while the filter runs, so at most one
+//      filter relying on it may be in use at a time.
+// Note: This filter should not be copied while it is in use, and should be
+//      closed before it is destroyed.
+//
+template<typename Ch>
+class basic_streaming_stdio_filter {
+public:
+    typedef Ch char_type;
+    struct category
+        : dual_use,
+          filter_tag,
+          multichar_tag,
+          closable_tag
+        { };
+    BOOST_STATIC_CONSTANT(std::streamsize, default_pipe_size = 64 * 1024);
+    explicit basic_streaming_stdio_filter( std::streamsize pipe_size =
+                                               default_pipe_size )
+        : pimpl_(new impl(pipe_size))
+        { }
+    virtual ~basic_streaming_stdio_filter()
+    {
+        if (pimpl_->owner_ == this)
+            pimpl_->stop();
+    }
+
+    template<typename Source>
+    std::streamsize read(Source& src, char_type* s, std::streamsize n)
+    {
+        impl& i = *pimpl_;
+        if (!i.worker_.joinable())
+            start(f_read);
+        std::unique_lock<std::mutex> lock(i.mutex_);
+        for (;;) {
+            std::size_t amt =
+                i.out_.read(s, static_cast<std::size_t>(n));
+            if (amt != 0) {
+                i.cond_.notify_all();
+                return static_cast<std::streamsize>(amt);
+            }
+            if (i.done_) {
+                i.rethrow();
+                return -1;
+            }
+            std::size_t space = i.in_.capacity() - i.in_.size();
+            if (!i.in_eof_ && space != 0) {
+                lock.unlock();
+                std::streamsize m =
+                    iostreams::read( src, &i.chunk_[0],
+                                     static_cast<std::streamsize>(
+                                         (std::min)(space, i.chunk_.size())) );
+                lock.lock();
+                if (m == -1)
+                    i.in_eof_ = true;
+                else if (m == 0)
+                    return 0;  // Non-blocking Source.
+                else
+                    i.in_.write(&i.chunk_[0], static_cast<std::size_t>(m));
+                i.cond_.notify_all();
+            } else {
+                i.cond_.wait(lock);
+            }
+        }
+    }
+
+    template<typename Sink>
+    std::streamsize write(Sink& snk, const char_type* s, std::streamsize n)
+    {
+        impl& i = *pimpl_;
+        if (!i.worker_.joinable())
+            start(f_write);
+        std::unique_lock<std::mutex> lock(i.mutex_);
+        std::streamsize result = 0;
+        while (result < n) {
+            if (i.done_) {
+                i.rethrow();
+                break;  // The filter has stopped reading.
+            }
+            std::size_t amt =
+                i.in_.write( s + result,
+                             static_cast<std::size_t>(n - result) );
+            if (amt != 0) {
+                i.cond_.notify_all();
+                result += static_cast<std::streamsize>(amt);
+            } else if (!drain(snk, lock)) {
+                i.cond_.wait(lock);
+            }
+        }
+        drain(snk, lock);
+        return n;
+    }
+
+    template<typename Device>
+    void close(Device& dev, BOOST_IOS::openmode which)
+    {
+        impl& i = *pimpl_;
+        if (!i.worker_.joinable())
+            return;
+        if (which == BOOST_IOS::in && (i.state_ & f_read) != 0) {
+            i.stop();
+            i.reset();
+        }
+        if (which == BOOST_IOS::out && (i.state_ & f_write) != 0) {
+            try {
+                std::unique_lock<std::mutex> lock(i.mutex_);
+                i.in_eof_ = true;
+                i.cond_.notify_all();
+                while (!i.done_ || !i.out_.empty())
+                    if (!drain(dev, lock))
+                        i.cond_.wait(lock);
+                i.rethrow();
+            } catch (...) {
+                i.stop();
+                i.reset();
+                throw;
+            }
+            i.stop();
+            i.reset();
+        }
+    }
+protected:
+    typedef BOOST_IOSTREAMS_CHAR_TRAITS(Ch)                   traits_type;
+    typedef BOOST_IOSTREAMS_BASIC_ISTREAM(Ch, traits_type)    istream_type;
+    typedef BOOST_IOSTREAMS_BASIC_OSTREAM(Ch, traits_type)    ostream_type;
+private:
+    typedef BOOST_IOSTREAMS_BASIC_STREAMBUF(Ch, traits_type)  streambuf_type;
+    typedef typename traits_type::int_type                    int_type;
+    typedef detail::scoped_redirector<Ch>                     scoped_redirector;
+    enum flag_type { f_read = 1, f_write = f_read << 1 };
+
+    // Filters the characters read from in, writing the result to out. The
+    // default implementation redirects the standard streams to in and out
+    // and calls do_filter().
+    virtual void do_filter(istream_type& in, ostream_type& out)
+    {
+        scoped_redirector
+            redirect_input(detail::standard_input((Ch*)0), in.rdbuf());
+        scoped_redirector
+            redirect_output(detail::standard_output((Ch*)0), out.rdbuf());
+        do_filter();
+    }
+
+    // Filters the characters read from std::cin, writing the result to
+    // std::cout; used by the default implementation of do_filter(in, out).
+    virtual void do_filter() { }
+
+    struct impl {
+        explicit impl(std::streamsize pipe_size)
+            : in_(static_cast<std::size_t>(pipe_size > 0 ? pipe_size : 1)),
+              out_(in_.capacity()),
+              chunk_((std::min)(in_.capacity(), std::size_t(4096))),
+              owner_(0), state_(0), in_eof_(false), done_(false),
+              aborted_(false)
+            { }
+
+        // Stops the background thread, discarding its pending input and
+        // output.
+        void stop()
+        {
+            if (!worker_.joinable())
+                return;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                in_eof_ = aborted_ = true;
+                cond_.notify_all();
+            }
+            worker_.join();
+        }
+
+        void reset()
+        {
+            const Ch* p;
+            std::size_t n;
+            while ((n = in_.readable(p)) != 0)
+                in_.consume(n);
+            while ((n = out_.readable(p)) != 0)
+                out_.consume(n);
+            owner_ = 0;
+            state_ = 0;
+            in_eof_ = done_ = aborted_ = false;
+            error_ = std::exception_ptr();
+        }
+
+        // Rethrows an exception thrown by the filter. Called with the lock
+        // held.
+        void rethrow()
+        {
+            if (error_) {
+                std::exception_ptr e = error_;
+                error_ = std::exception_ptr();
+                std::rethrow_exception(e);
+            }
+        }
+
+        // Moves up to n characters from the input pipe to s, blocking while
+        // the pipe is empty; returns 0 at the end of the input. Called by
+        // the background thread.
+        std::size_t take_input(Ch* s, std::size_t n)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (in_.empty() && !in_eof_)
+                cond_.wait(lock);
+            std::size_t result = in_.read(s, n);
+            cond_.notify_all();
+            return result;
+        }
+
+        // Moves n characters from s to the output pipe, blocking while the
+        // pipe is full; returns false if the output is being discarded.
+        // Called by the background thread.
+        bool give_output(const Ch* s, std::size_t n)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            while (n != 0) {
+                if (aborted_)
+                    return false;
+                std::size_t amt = out_.write(s, n);
+                if (amt != 0) {
+                    s += amt;
+                    n -= amt;
+                    cond_.notify_all();
+                } else {
+                    cond_.wait(lock);
+                }
+            }
+            return true;
+        }
+
+        detail::spsc_ring<Ch>    in_;      // Characters for the filter.
+        detail::spsc_ring<Ch>    out_;     // Characters from the filter.
+        std::vector<Ch>          chunk_;   // Used by the calling thread.
+        const void*              owner_;   // Copy which started the thread.
+        int                      state_;
+        bool                     in_eof_;
+        bool                     done_;    // The filter has returned.
+        bool                     aborted_;
+        std::exception_ptr       error_;
+        std::mutex               mutex_;
+        std::condition_variable  cond_;
+        std::thread              worker_;
+    };
+
+    // Stream buffer through which the background thread reads from the
+    // input pipe and writes to the output pipe.
+    class pipe_buf : public streambuf_type {
+    public:
+        pipe_buf(impl& i)
+            : impl_(i), gbuf_(i.chunk_.size()), pbuf_(i.chunk_.size())
+        {
+            this->setg(&gbuf_[0], &gbuf_[0], &gbuf_[0]);
+            this->setp(&pbuf_[0], &pbuf_[0] + pbuf_.size());
+        }
+    protected:
+        int_type underflow()
+        {
+            // Hand over pending output before waiting for more input.
+            sync_output();
+            std::size_t n = impl_.take_input(&gbuf_[0], gbuf_.size());
+            if (n == 0)
+                return traits_type::eof();
+            this->setg(&gbuf_[0], &gbuf_[0], &gbuf_[0] + n);
+            return traits_type::to_int_type(gbuf_[0]);
+        }
+        int_type overflow(int_type c)
+        {
+            if (!sync_output())
+                return traits_type::eof();
+            if (!traits_type::eq_int_type(c, traits_type::eof())) {
+                *this->pptr() = traits_type::to_char_type(c);
+                this->pbump(1);
+            }
+            return traits_type::not_eof(c);
+        }
+        int sync() { return sync_output() ? 0 : -1; }
+    private:
+        bool sync_output()
+        {
+            std::size_t n =
+                static_cast<std::size_t>(this->pptr() - this->pbase());
+            this->setp(&pbuf_[0], &pbuf_[0] + pbuf_.size());
+            return n == 0 || impl_.give_output(&pbuf_[0], n);
+        }
+        impl&            impl_;
+        std::vector<Ch>  gbuf_;
+        std::vector<Ch>  pbuf_;
+    };
+
+    void start(flag_type f)
+    {
+        impl& i = *pimpl_;
+        i.owner_ = this;
+        i.state_ |= f;
+        i.worker_ = std::thread(&basic_streaming_stdio_filter::run, this);
+    }
+
+    // Body of the background thread.
+    void run()
+    {
+        impl&     i = *pimpl_;
+        pipe_buf  buf(i);
+        try {
+            istream_type  in(&buf);
+            ostream_type  out(&buf);
+            do_filter(in, out);
+            out.flush();
+        } catch (...) {
+            buf.pubsync();  // Deliver the characters written so far.
+            std::lock_guard<std::mutex> lock(i.mutex_);
+            i.error_ = std::current_exception();
+        }
+        std::lock_guard<std::mutex> lock(i.mutex_);
+        i.done_ = true;
+        i.cond_.notify_all();
+    }
+
+    // Writes the contents of the output pipe to snk, returning false if
+    // the pipe was empty. Called with the lock held.
+    template<typename Sink>
+    bool drain(Sink& snk, std::unique_lock<std::mutex>& lock)
+    {
+        impl& i = *pimpl_;
+        std::size_t amt = i.out_.read(&i.chunk_[0], i.chunk_.size());
+        if (amt == 0)
+            return false;
+        i.cond_.notify_all();
+        lock.unlock();
+        try {
+            iostreams::write( snk, &i.chunk_[0],
+                              static_cast<std::streamsize>(amt) );
+        } catch (...) {
+            lock.lock();
+            throw;
+        }
+        lock.lock();
+        return true;
+    }
+
+    shared_ptr<impl> pimpl_;
+};
+BOOST_IOSTREAMS_PIPABLE(basic_streaming_stdio_filter, 1)
+
+typedef basic_streaming_stdio_filter<char>     streaming_stdio_filter;
+typedef basic_streaming_stdio_filter<wchar_t>  wstreaming_stdio_filter;
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
+
+#endif // #ifndef BOOST_IOSTREAMS_STREAMING_STDIO_FILTER_HPP_INCLUDED
@@ -23,6 +23,7 @@
 #include <boost/cstdint.hpp> // uint*_t
 #include <boost/detail/workaround.hpp>
 #include <boost/iostreams/constants.hpp>   // buffer size.
+#include <boost/iostreams/detail/adaptive_level.hpp>
 #include <boost/iostreams/detail/config/auto_link.hpp>
 #include <boost/iostreams/detail/config/dyn_link.hpp>
 #include <boost/iostreams/detail/config/wide_streams.hpp>
@@ -99,6 +100,7 @@ const int default_window_bits                = 15;
 const int default_mem_level                  = 8;
 const bool default_crc                       = false;
 const bool default_noheader                  = false;
+const int default_adaptive_block_size        = 1048576;
 
 } // End namespace zlib. 
 
@@ -106,6 +108,9 @@ const bool default_noheader                  = false;
 // Class name: zlib_params.
 // Description: Encapsulates the parameters passed to deflateInit2
 //      and inflateInit2 to customize compression and decompression.
+//      If adaptive is true, the compressor moves its level within
+//      [min_level, max_level] once per adaptive_block_size characters
+//      of input, according to the speed of the downstream sink.
 //
 struct zlib_params {
 
@@ -119,7 +124,10 @@ struct zlib_params {
                  bool calculate_crc_ = zlib::default_crc )
         : level(level_), method(method_), window_bits(window_bits_),
           mem_level(mem_level_), strategy(strategy_),  
-          noheader(noheader_), calculate_crc(calculate_crc_)
+          noheader(noheader_), calculate_crc(calculate_crc_),
+          adaptive(false), min_level(zlib::best_speed),
+          max_level(zlib::best_compression),
+          adaptive_block_size(zlib::default_adaptive_block_size)
         { }
     int level;
     int method;
@@ -128,6 +136,10 @@ struct zlib_params {
     int strategy;
     bool noheader;
     bool calculate_crc;
+    bool adaptive;
+    int min_level;
+    int max_level;
+    int adaptive_block_size;
 };
 
 //
@@ -201,6 +213,7 @@ protected:
                 bool compress );
     int xdeflate(int flush);  // Prefix 'x' prevents symbols from being 
     int xinflate(int flush);  // redefined when Z_PREFIX is defined
+    bool set_level(int level);
     void reset(bool compress, bool realloc);
 public:
     zlib::ulong crc() const { return crc_; }
@@ -213,6 +226,7 @@ private:
                   void* derived );
     void*        stream_;         // Actual type: z_stream*.
     bool         calculate_crc_;
+    int          strategy_;
     zlib::ulong  crc_;
     zlib::ulong  crc_imp_;
     int          total_in_;
@@ -232,6 +246,9 @@ public:
     bool filter( const char*& src_begin, const char* src_end,
                  char*& dest_begin, char* dest_end, bool flush );
     void close();
+    int level() const { return adapt_.level(); }
+private:
+    adaptive_level adapt_;
 };
 
 //
@@ -274,6 +291,7 @@ public:
                            std::streamsize buffer_size = default_device_buffer_size );
     zlib::ulong crc() { return this->filter().crc(); }
     int total_in() {  return this->filter().total_in(); }
+    int level() { return this->filter().level(); }
 };
 BOOST_IOSTREAMS_PIPABLE(basic_zlib_compressor, 1)
 
@@ -340,7 +358,16 @@ void zlib_allocator<Alloc, Base>::deallocate(void* self, void* address)
 
 template<typename Alloc>
 zlib_compressor_impl<Alloc>::zlib_compressor_impl(const zlib_params& p)
-{ init(p, true, static_cast<zlib_allocator<Alloc>&>(*this)); }
+{
+    // Z_DEFAULT_COMPRESSION stands for level 6.
+    adapt_.open( p.adaptive,
+                 p.level == zlib::default_compression ? 6 : p.level,
+                 p.min_level, p.max_level, p.adaptive_block_size );
+    zlib_params q(p);
+    if (adapt_.enabled())
+        q.level = adapt_.level();
+    init(q, true, static_cast<zlib_allocator<Alloc>&>(*this));
+}
 
 template<typename Alloc>
 zlib_compressor_impl<Alloc>::~zlib_compressor_impl()
@@ -351,15 +378,24 @@ bool zlib_compressor_impl<Alloc>::filter
     ( const char*& src_begin, const char* src_end,
       char*& dest_begin, char* dest_end, bool flush )
 {
+    const char* next = src_begin;
+    adapt_.begin();
     before(src_begin, src_end, dest_begin, dest_end);
     int result = xdeflate(flush ? zlib::finish : zlib::no_flush);
+    if (adapt_.pending() && !flush && set_level(adapt_.target()))
+        adapt_.commit();
     after(src_begin, dest_begin, true);
+    adapt_.end(src_begin - next, dest_begin == dest_end);
     zlib_error::check BOOST_PREVENT_MACRO_SUBSTITUTION(result);
     return result != zlib::stream_end;
 }
 
 template<typename Alloc>
-void zlib_compressor_impl<Alloc>::close() { reset(true, true); }
+void zlib_compressor_impl<Alloc>::close()
+{
+    reset(true, true);
+    adapt_.close();
+}
 
 //------------------Implementation of zlib_decompressor_impl------------------//
 
@@ -20,6 +20,7 @@
 #include <boost/config.hpp>  // MSVC, STATIC_CONSTANT, DEDUCED_TYPENAME, DINKUM.
 #include <boost/detail/workaround.hpp>
 #include <boost/iostreams/constants.hpp>   // buffer size.
+#include <boost/iostreams/detail/adaptive_level.hpp>
 #include <boost/iostreams/detail/config/auto_link.hpp>
 #include <boost/iostreams/detail/config/dyn_link.hpp>
 #include <boost/iostreams/detail/config/wide_streams.hpp>
@@ -67,20 +68,31 @@ const int null                               = 0;
 
                     // Default values
 
+const int default_adaptive_block_size        = 1048576;
+
 } // End namespace zstd.
 
 //
 // Class name: zstd_params.
 // Description: Encapsulates the parameters passed to zstddec_init
-//      to customize compression and decompression.
+//      to customize compression and decompression. If adaptive is true,
+//      the compressor moves its level within [min_level, max_level] once
+//      per adaptive_block_size characters of input, according to the speed
+//      of the downstream sink; each change of level starts a new frame.
 //
 struct zstd_params {
 
     // Non-explicit constructor.
     zstd_params( uint32_t level = zstd::default_compression )
-        : level(level)
+        : level(level), adaptive(false), min_level(zstd::best_speed),
+          max_level(zstd::best_compression),
+          adaptive_block_size(zstd::default_adaptive_block_size)
         { }
     uint32_t level;
+    bool adaptive;
+    uint32_t min_level;
+    uint32_t max_level;
+    int adaptive_block_size;
 };
 
 //
@@ -153,6 +165,8 @@ protected:
                 bool compress );
     int deflate(int action);
     int inflate(int action);
+    bool set_level(uint32_t level);
+    bool restarting() const { return restarting_; }
     void reset(bool compress, bool realloc);
 private:
     void do_init( const zstd_params& p, bool compress,
@@ -164,7 +178,8 @@ private:
     void*         in_;              // Actual type: ZSTD_inBuffer *
     void*         out_;             // Actual type: ZSTD_outBuffer *
     int eof_;
-    uint32_t level;
+    bool restarting_;
+    uint32_t level_;
 };
 
 //
@@ -180,6 +195,9 @@ public:
     bool filter( const char*& src_begin, const char* src_end,
                  char*& dest_begin, char* dest_end, bool flush );
     void close();
+    uint32_t level() const { return static_cast<uint32_t>(adapt_.level()); }
+private:
+    adaptive_level adapt_;
 };
 
 //
@@ -217,6 +235,7 @@ public:
     typedef typename base_type::category                category;
     basic_zstd_compressor( const zstd_params& = zstd::default_compression,
                            std::streamsize buffer_size = default_device_buffer_size );
+    uint32_t level() { return this->filter().level(); }
 };
 BOOST_IOSTREAMS_PIPABLE(basic_zstd_compressor, 1)
 
@@ -279,7 +298,14 @@ void zstd_allocator<Alloc, Base>::deallocate(void* self, void* address)
 
 template<typename Alloc>
 zstd_compressor_impl<Alloc>::zstd_compressor_impl(const zstd_params& p)
-{ init(p, true, static_cast<zstd_allocator<Alloc>&>(*this)); }
+{
+    adapt_.open( p.adaptive, static_cast<int>(p.level),
+                 static_cast<int>(p.min_level), static_cast<int>(p.max_level),
+                 p.adaptive_block_size );
+    zstd_params q(p);
+    q.level = static_cast<uint32_t>(adapt_.level());
+    init(q, true, static_cast<zstd_allocator<Alloc>&>(*this));
+}
 
 template<typename Alloc>
 zstd_compressor_impl<Alloc>::~zstd_compressor_impl()
@@ -290,14 +316,30 @@ bool zstd_compressor_impl<Alloc>::filter
     ( const char*& src_begin, const char* src_end,
       char*& dest_begin, char* dest_end, bool flush )
 {
+    const char* next = src_begin;
+    adapt_.begin();
     before(src_begin, src_end, dest_begin, dest_end);
+    if (adapt_.pending() && (!flush || restarting())) {
+        // Input is withheld until the current frame has been ended.
+        if (!set_level(static_cast<uint32_t>(adapt_.target()))) {
+            after(src_begin, dest_begin, true);
+            adapt_.end(0, true);
+            return true;
+        }
+        adapt_.commit();
+    }
     int result = deflate(flush ? zstd::finish : zstd::run);
     after(src_begin, dest_begin, true);
+    adapt_.end(src_begin - next, dest_begin == dest_end);
     return result != zstd::stream_end;
 }
 
 template<typename Alloc>
-void zstd_compressor_impl<Alloc>::close() { reset(true, true); }
+void zstd_compressor_impl<Alloc>::close()
+{
+    reset(true, true);
+    adapt_.close();
+}
 
 //------------------Implementation of zstd_decompressor_impl------------------//
 
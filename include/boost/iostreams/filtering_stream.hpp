@@ -13,6 +13,8 @@
 #endif              
 
 #include <memory>                                     // allocator.
+#include <stdexcept>                                  // logic_error.
+#include <utility>                                    // pair.
 #include <boost/iostreams/detail/access_control.hpp>
 #include <boost/iostreams/detail/char_traits.hpp>
 #include <boost/iostreams/detail/iostream.hpp>        // standard streams.
@@ -23,6 +25,7 @@
 #include <boost/mpl/and.hpp>
 #include <boost/mpl/bool.hpp>
 #include <boost/static_assert.hpp>
+#include <boost/throw_exception.hpp>
 #include <boost/type_traits/is_convertible.hpp>
 
 // Must come last.
@@ -94,6 +97,26 @@ protected:
                  typename Chain::traits_type
             >::stream_type                                stream_type;
     filtering_stream_base() : stream_type(0) { this->set_chain(&chain_); }
+public:
+    typedef typename Chain::char_type                     char_type;
+
+    // Provide access to the buffers of the first link of the chain without
+    // copying.
+    std::pair<const char_type*, const char_type*>
+    peek_window(std::streamsize n = 1)
+    {
+        if (!chain_.is_complete())
+            boost::throw_exception(std::logic_error("chain incomplete"));
+        return chain_.front().peek_window(n);
+    }
+    void consume(std::streamsize n) { chain_.front().consume(n); }
+    std::pair<char_type*, char_type*> reserve(std::streamsize n = 1)
+    {
+        if (!chain_.is_complete())
+            boost::throw_exception(std::logic_error("chain incomplete"));
+        return chain_.front().reserve(n);
+    }
+    void commit(std::streamsize n) { chain_.front().commit(n); }
 private:
     void notify() { this->rdbuf(chain_.empty() ? 0 : &chain_.front()); }
     Chain chain_;
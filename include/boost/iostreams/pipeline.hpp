@@ -66,6 +66,7 @@ public:
     void for_each(Fn fn) const { fn(component_); }
     template<typename Chain>
     void push(Chain& chn) const { chn.push(component_); }
+    const Component& component() const { return component_; }
 private:
     pipeline_segment operator=(const pipeline_segment&);
     const Component& component_;
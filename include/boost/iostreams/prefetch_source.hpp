@@ -0,0 +1,271 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class template prefetch_source, which reads ahead from a Source
+// on a background thread. Requires C++11 threading support.
+
+#ifndef BOOST_IOSTREAMS_PREFETCH_SOURCE_HPP_INCLUDED
+#define BOOST_IOSTREAMS_PREFETCH_SOURCE_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>                      // BOOST_NO_CXX11_XXX.
+
+#if defined(BOOST_NO_CXX11_HDR_CONDITION_VARIABLE) || \
+    defined(BOOST_NO_CXX11_HDR_MUTEX) || \
+    defined(BOOST_NO_CXX11_HDR_THREAD)
+# error "Boost.Iostreams: threaded components require C++11 threading support"
+#endif
+
+#include <algorithm>                             // copy, min.
+#include <condition_variable>
+#include <cstddef>                               // size_t.
+#include <exception>                             // exception_ptr.
+#include <mutex>
+#include <thread>
+#include <utility>                               // pair.
+#include <vector>
+#include <boost/assert.hpp>
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/detail/call_traits.hpp>
+#include <boost/iostreams/detail/ios.hpp>        // openmode, streamsize.
+#include <boost/iostreams/operations.hpp>
+#include <boost/iostreams/traits.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+//
+// Template name: prefetch_source.
+// Template parameters:
+//      Source - A model of Source which is not Direct.
+// Description: Source which reads from the given Source on a background
+//      thread into a fixed number of buffers, allocated at construction, and
+//      hands them to the reading thread in order. The background thread is
+//      started by the first read and stays up to depth buffers ahead of the
+//      reader. Besides read(), which copies characters out of the buffers,
+//      peek_window() and consume() give direct access to the current buffer;
+//      they are available only on the prefetch_source itself, so that a
+//      prefetch_source added to a chain is read by copying. An exception thrown on the background thread is rethrown once the
+//      characters read before it have been consumed. Copies share their
+//      state.
+//
+template<typename Source>
+class prefetch_source {
+private:
+    BOOST_STATIC_ASSERT((
+        is_convertible<
+            BOOST_DEDUCED_TYPENAME mode_of<Source>::type,
+            input
+        >::value
+    ));
+    BOOST_STATIC_ASSERT(!is_direct<Source>::value);
+    typedef typename detail::param_type<Source>::type  param_type;
+public:
+    typedef typename char_type_of<Source>::type        char_type;
+    struct category
+        : source_tag,
+          closable_tag
+        { };
+    BOOST_STATIC_CONSTANT(std::size_t, default_depth = 4);
+    BOOST_STATIC_CONSTANT(std::streamsize, default_buffer_size = 64 * 1024);
+    explicit prefetch_source( param_type src,
+                              std::size_t depth = default_depth,
+                              std::streamsize buffer_size =
+                                  default_buffer_size )
+        : pimpl_(new impl(src, depth, buffer_size))
+        { }
+
+    std::streamsize read(char_type* s, std::streamsize n)
+    {
+        if (n <= 0)
+            return 0;
+        impl& i = *pimpl_;
+        if (!i.worker_.joinable())
+            i.start();
+        std::streamsize result = 0;
+        while (result < n) {
+            if (i.gptr_ == i.egptr_ && !i.next(result == 0))
+                break;
+            std::streamsize amt =
+                (std::min)( n - result,
+                            static_cast<std::streamsize>(i.egptr_ - i.gptr_) );
+            std::copy(i.gptr_, i.gptr_ + amt, s + result);
+            i.gptr_ += amt;
+            result += amt;
+        }
+        return result != 0 ? result : -1;
+    }
+
+    // Returns the unread characters of the current buffer, waiting for the
+    // next buffer if the current one has been consumed; returns an empty
+    // range at the end of the sequence.
+    std::pair<const char_type*, const char_type*> peek_window()
+    {
+        impl& i = *pimpl_;
+        if (!i.worker_.joinable())
+            i.start();
+        if (i.gptr_ == i.egptr_)
+            i.next(true);
+        return std::pair<const char_type*, const char_type*>(i.gptr_, i.egptr_);
+    }
+
+    // Discards the first n characters returned by peek_window().
+    void consume(std::streamsize n)
+    {
+        impl& i = *pimpl_;
+        BOOST_ASSERT(0 <= n && n <= i.egptr_ - i.gptr_);
+        i.gptr_ += n;
+    }
+
+    void close()
+    {
+        impl& i = *pimpl_;
+        i.stop();
+        iostreams::close(i.src_, BOOST_IOS::in);
+    }
+
+    Source& source() { return pimpl_->src_; }
+private:
+    struct impl {
+        impl(param_type src, std::size_t depth, std::streamsize buffer_size)
+            : src_(src),
+              buffers_(depth != 0 ? depth : 1),
+              sizes_(buffers_.size()),
+              buffer_size_(buffer_size > 0 ? buffer_size : 1),
+              head_(0), tail_(0), eof_(false), stop_(false),
+              gptr_(0), egptr_(0), holding_(false)
+        {
+            for (std::size_t z = 0, n = buffers_.size(); z < n; ++z)
+                buffers_[z].resize(static_cast<std::size_t>(buffer_size_));
+        }
+        ~impl() { stop(); }
+
+        void start()
+        {
+            head_ = tail_ = 0;
+            eof_ = stop_ = false;
+            error_ = std::exception_ptr();
+            gptr_ = egptr_ = 0;
+            holding_ = false;
+            worker_ = std::thread(&impl::run, this);
+        }
+
+        void stop()
+        {
+            if (!worker_.joinable())
+                return;
+            {
+                std::lock_guard<std::mutex> lock(mutex_);
+                stop_ = true;
+            }
+            cond_.notify_all();
+            worker_.join();
+        }
+
+        // Releases the current buffer and makes the next one current,
+        // returning false at the end of the sequence or, if block is false,
+        // if the next buffer is not yet available. Called by the reading
+        // thread.
+        bool next(bool block)
+        {
+            std::unique_lock<std::mutex> lock(mutex_);
+            if (holding_) {
+                ++tail_;
+                holding_ = false;
+                gptr_ = egptr_ = 0;
+                cond_.notify_all();
+            }
+            while (head_ == tail_) {
+                if (!block || eof_)
+                    return false;
+                if (error_)
+                    std::rethrow_exception(error_);
+                cond_.wait(lock);
+            }
+            std::size_t slot = tail_ % buffers_.size();
+            gptr_ = &buffers_[slot][0];
+            egptr_ = gptr_ + sizes_[slot];
+            holding_ = true;
+            return true;
+        }
+
+        // Body of the background thread.
+        void run()
+        {
+            const std::size_t depth = buffers_.size();
+            for (;;) {
+                std::size_t slot;
+                {
+                    std::unique_lock<std::mutex> lock(mutex_);
+                    while (head_ - tail_ == depth && !stop_)
+                        cond_.wait(lock);
+                    if (stop_)
+                        return;
+                    slot = head_ % depth;
+                }
+                std::streamsize amt;
+                try {
+                    amt = iostreams::read(src_, &buffers_[slot][0], buffer_size_);
+                } catch (...) {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    error_ = std::current_exception();
+                    cond_.notify_all();
+                    return;
+                }
+                if (amt == 0) {  // Not expected from a blocking Source.
+                    std::this_thread::yield();
+                    continue;
+                }
+                {
+                    std::lock_guard<std::mutex> lock(mutex_);
+                    if (amt == -1) {
+                        eof_ = true;
+                    } else {
+                        sizes_[slot] = amt;
+                        ++head_;
+                    }
+                    cond_.notify_all();
+                }
+                if (amt == -1)
+                    return;
+            }
+        }
+
+        typename detail::value_type<Source>::type        src_;
+        std::vector< std::vector<char_type> >            buffers_;
+        std::vector<std::streamsize>                     sizes_;
+        const std::streamsize                            buffer_size_;
+        std::mutex                                       mutex_;
+        std::condition_variable                          cond_;
+        std::size_t                                      head_;  // Buffers filled.
+        std::size_t                                      tail_;  // Buffers released.
+        bool                                             eof_;
+        bool                                             stop_;
+        std::exception_ptr                               error_;
+        std::thread                                      worker_;
+
+        // Accessed only by the reading thread.
+        const char_type*                                 gptr_;
+        const char_type*                                 egptr_;
+        bool                                             holding_;
+    };
+
+    shared_ptr<impl> pimpl_;
+};
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
+
+#endif // #ifndef BOOST_IOSTREAMS_PREFETCH_SOURCE_HPP_INCLUDED
@@ -0,0 +1,301 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class template static_pipeline, a Device composed at compile
+// time from a sequence of Filters and a Device, and the function template
+// make_static_pipeline, which creates a static_pipeline from a pipeline
+// expression.
+
+// Note: bidirectional streams are not supported.
+
+#ifndef BOOST_IOSTREAMS_STATIC_PIPELINE_HPP_INCLUDED
+#define BOOST_IOSTREAMS_STATIC_PIPELINE_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <algorithm>                                    // copy, min.
+#include <cstddef>                                      // size_t.
+#include <vector>
+#include <boost/config.hpp>                             // DEDUCED_TYPENAME.
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/compose.hpp>
+#include <boost/iostreams/constants.hpp>                // default_device_buffer_size.
+#include <boost/iostreams/detail/adapter/direct_adapter.hpp>
+#include <boost/iostreams/detail/call_traits.hpp>
+#include <boost/iostreams/detail/ios.hpp>               // openmode, streamsize.
+#include <boost/iostreams/operations.hpp>
+#include <boost/iostreams/pipeline.hpp>
+#include <boost/iostreams/traits.hpp>
+#include <boost/mpl/bool.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+namespace detail {
+
+//
+// Template name: static_link.
+// Description: Device view of a Device, buffering the characters read or
+//      written one at a time by a single-character Filter so that the Device
+//      is accessed in blocks.
+// Template parameters:
+//      Device - An indirect model of Source or Sink.
+//
+template<typename Device>
+class static_link {
+private:
+    typedef typename detail::param_type<Device>::type       param_type;
+    typedef typename
+            iostreams::select<  // Disambiguation for Tru64.
+                is_direct<Device>,  direct_adapter<Device>,
+                is_std_io<Device>,  Device&,
+                else_,              Device
+            >::type                                         value_type;
+    typedef typename mode_of<Device>::type                  mode;
+    BOOST_STATIC_ASSERT(is_device<Device>::value);
+    BOOST_STATIC_ASSERT(!(is_convertible<mode, two_sequence>::value));
+public:
+    typedef typename char_type_of<Device>::type             char_type;
+    struct category
+        : mode,
+          device_tag,
+          closable_tag,
+          flushable_tag,
+          localizable_tag,
+          optimally_buffered_tag,
+          peekable_tag
+        { };
+    static_link(param_type dev) : device_(dev), ptr_(0), end_(0) { }
+
+    std::streamsize read(char_type* s, std::streamsize n)
+    {
+        if (ptr_ == end_) {
+            // Returning a constant rather than result lets the compiler see
+            // that get() never reports a character it was not given.
+            std::streamsize result = fill();
+            if (result <= 0)
+                return result < 0 ? -1 : 0;
+        }
+        std::size_t amt =
+            (std::min)(static_cast<std::size_t>(n), end_ - ptr_);
+        std::copy(&buf_[ptr_], &buf_[ptr_] + amt, s);
+        ptr_ += amt;
+        return static_cast<std::streamsize>(amt);
+    }
+
+    bool putback(char_type c)
+    {
+        if (ptr_ == 0)
+            return false;
+        buf_[--ptr_] = c;
+        return true;
+    }
+
+    std::streamsize write(const char_type* s, std::streamsize n)
+    {
+        if (buf_.empty())
+            allocate();
+        std::streamsize result = 0;
+        while (result < n) {
+            if (end_ == buf_.size() && !flush_buffer())
+                break;
+            std::size_t amt =
+                (std::min)( static_cast<std::size_t>(n - result),
+                            buf_.size() - end_ );
+            std::copy(s + result, s + result + amt, &buf_[end_]);
+            end_ += amt;
+            result += static_cast<std::streamsize>(amt);
+        }
+        return result;
+    }
+
+    bool flush() { return drain(is_output()) && iostreams::flush(device_); }
+    void close() { close(is_output()); }
+
+    std::streamsize optimal_buffer_size() const
+    { return iostreams::optimal_buffer_size(device_); }
+
+    template<typename Locale> // Avoid dependency on <locale>
+    void imbue(const Locale& loc) { iostreams::imbue(device_, loc); }
+private:
+    typedef is_convertible<mode, output>  is_output;
+    BOOST_STATIC_CONSTANT(std::size_t, putback_size = 4);
+    void allocate()
+    {
+        std::streamsize size = iostreams::optimal_buffer_size(device_);
+        if (size <= 0)
+            size = default_device_buffer_size;
+        buf_.resize(static_cast<std::size_t>(size) + putback_size);
+    }
+
+    // Reads a block from the device, retaining the last few characters of
+    // the previous block for use by putback().
+    std::streamsize fill()
+    {
+        if (buf_.empty())
+            allocate();
+        std::size_t keep = (std::min)(end_, std::size_t(putback_size));
+        std::copy(&buf_[0] + end_ - keep, &buf_[0] + end_, &buf_[0]);
+        ptr_ = end_ = keep;
+        std::streamsize result =
+            iostreams::read( device_, &buf_[keep],
+                             static_cast<std::streamsize>(
+                                 buf_.size() - keep
+                             ) );
+        if (result > 0)
+            end_ += static_cast<std::size_t>(result);
+        return result;
+    }
+
+    // Returns true if one or more characters were written.
+    bool flush_buffer()
+    {
+        std::streamsize amt =
+            iostreams::write( device_, &buf_[0],
+                              static_cast<std::streamsize>(end_) );
+        if (amt <= 0)
+            return false;
+        std::copy(&buf_[0] + amt, &buf_[0] + end_, &buf_[0]);
+        end_ -= static_cast<std::size_t>(amt);
+        return true;
+    }
+
+    bool drain(mpl::false_) { return true; }
+    bool drain(mpl::true_)
+    {
+        while (end_ != 0)
+            if (!flush_buffer())
+                return false;
+        return true;
+    }
+
+    void close(mpl::false_)
+    {
+        ptr_ = end_ = 0;
+        iostreams::close(device_, BOOST_IOS::in);
+    }
+
+    void close(mpl::true_)
+    {
+        try {
+            while (end_ != 0 && flush_buffer()) ;
+        } catch (...) {
+            ptr_ = end_ = 0;
+            try {
+                iostreams::close(device_, BOOST_IOS::out);
+            } catch (...) { }
+            throw;
+        }
+        ptr_ = end_ = 0;
+        iostreams::close(device_, BOOST_IOS::out);
+    }
+
+    value_type              device_;
+    std::vector<char_type>  buf_;
+    std::size_t             ptr_;  // Next character to read.
+    std::size_t             end_;  // End of buffered characters.
+};
+
+// Determines the type of the Device read or written by a Filter in a
+// static_pipeline: a multi-character Filter accesses the next component
+// directly, while a single-character Filter accesses it through a buffer.
+template<typename Filter, typename Device>
+struct static_link_traits
+    : mpl::if_<
+          is_convertible<
+              BOOST_DEDUCED_TYPENAME category_of<Filter>::type,
+              multichar_tag
+          >,
+          Device,
+          static_link<Device>
+      >
+    { };
+
+} // End namespace detail.
+
+//
+// Template name: static_pipeline.
+// Description: Device view of a Filter followed by a Device, which may itself
+//      be a static_pipeline. Unlike a chain, the components are joined at
+//      compile time: each Filter invokes the next component directly, without
+//      virtual function calls, through a buffer only where the Filter reads
+//      or writes a single character at a time.
+// Template parameters:
+//      Filter - A model of Filter.
+//      Next - An indirect model of Device, typically a static_pipeline.
+//
+template<typename Filter, typename Next>
+class static_pipeline
+    : public detail::composite_device<
+                 Filter,
+                 typename detail::static_link_traits<Filter, Next>::type
+             >
+{
+private:
+    typedef typename detail::static_link_traits<Filter, Next>::type  link_type;
+    typedef detail::composite_device<Filter, link_type>             base_type;
+public:
+    typedef typename detail::param_type<Next>::type                 param_type;
+    static_pipeline(const Filter& flt, param_type next)
+        : base_type(flt, link_type(next))
+        { }
+};
+
+namespace detail {
+
+template<typename Pipeline, typename Next>
+struct static_pipeline_fold;
+
+template<typename Filter, typename Next>
+struct static_pipeline_fold<pipeline_segment<Filter>, Next> {
+    typedef static_pipeline<Filter, Next> type;
+    static type make(const pipeline_segment<Filter>& p, const Next& next)
+    { return type(p.component(), const_cast<Next&>(next)); }
+};
+
+template<typename Pipeline, typename Filter, typename Next>
+struct static_pipeline_fold<pipeline<Pipeline, Filter>, Next> {
+    typedef static_pipeline<Filter, Next>                next_type;
+    typedef static_pipeline_fold<Pipeline, next_type>    fold_type;
+    typedef typename fold_type::type                     type;
+    static type make(const pipeline<Pipeline, Filter>& p, const Next& next)
+    {
+        return fold_type::make(
+                   p.tail(),
+                   next_type(p.head(), const_cast<Next&>(next))
+               );
+    }
+};
+
+} // End namespace detail.
+
+// Returns a static_pipeline composed of the components of the given pipeline,
+// which must end with a Device; for example, the result for the pipeline
+// f1 | f2 | dev has type static_pipeline<F1, static_pipeline<F2, Device> >.
+// Standard streams and stream buffers are stored by reference; other
+// components are copied.
+template<typename Pipeline, typename Device>
+typename detail::static_pipeline_fold<Pipeline, Device>::type
+make_static_pipeline(const pipeline<Pipeline, Device>& p)
+{
+    BOOST_STATIC_ASSERT(is_device<Device>::value);
+    return detail::static_pipeline_fold<Pipeline, Device>::make(
+               p.tail(), p.head()
+           );
+}
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
+
+#endif // #ifndef BOOST_IOSTREAMS_STATIC_PIPELINE_HPP_INCLUDED
@@ -12,6 +12,7 @@
 # pragma once
 #endif
 
+#include <utility>                              // pair.
 #include <boost/iostreams/constants.hpp>
 #include <boost/iostreams/detail/char_traits.hpp>
 #include <boost/iostreams/detail/config/overload_resolution.hpp>
@@ -152,6 +153,12 @@ public:
     Device& operator*() { return *this->member; }
     Device* operator->() { return &*this->member; }
     Device* component() { return this->member.component(); }
+    std::pair<const char_type*, const char_type*>
+    peek_window(std::streamsize n = 1) { return this->member.peek_window(n); }
+    void consume(std::streamsize n) { this->member.consume(n); }
+    std::pair<char_type*, char_type*> reserve(std::streamsize n = 1)
+    { return this->member.reserve(n); }
+    void commit(std::streamsize n) { this->member.commit(n); }
 private:
     void open_impl(const Device& dev BOOST_IOSTREAMS_PUSH_PARAMS()) // For forwarding.
     { 
@@ -12,6 +12,7 @@
 # pragma once
 #endif
 
+#include <cstddef>           // size_t.
 #include <memory>            // allocator.
 #include <boost/config.hpp>  // BOOST_DEDUCED_TYPENAME.
 #include <boost/iostreams/detail/char_traits.hpp>
@@ -21,6 +22,8 @@
 #include <boost/iostreams/detail/streambuf/direct_streambuf.hpp>
 #include <boost/iostreams/detail/streambuf/indirect_streambuf.hpp>
 #include <boost/iostreams/traits.hpp>
+#include <boost/mpl/if.hpp>
+#include <boost/mpl/or.hpp>
 #include <boost/static_assert.hpp>
 #include <boost/throw_exception.hpp>
 #include <boost/type_traits/is_convertible.hpp>
@@ -32,17 +35,46 @@ namespace boost { namespace iostreams { namespace detail {
 
 template<typename T, typename Tr, typename Alloc, typename Mode>
 struct stream_buffer_traits {
+    typedef typename category_of<T>::type category;
     typedef typename
             mpl::if_<
-                is_convertible<
-                    BOOST_DEDUCED_TYPENAME category_of<T>::type,
-                    direct_tag
+                mpl::or_<
+                    is_convertible<category, direct_tag>,
+                    is_convertible<category, growable_tag>
                 >,
                 direct_streambuf<T, Tr>,
                 indirect_streambuf<T, Tr, Alloc, Mode>
             >::type type;
 };
 
+// Allocates storage for objects of type T, and for objects of derived types,
+// using Alloc. Used by stream_buffer so that the chain links which hold a
+// stream buffer are obtained from the same allocator as its character buffer.
+template<typename T, typename Alloc>
+struct allocated_storage {
+#if defined(BOOST_NO_STD_ALLOCATOR)
+    typedef std::allocator<T> allocator_type;
+#elif defined(BOOST_NO_CXX11_ALLOCATOR)
+    typedef typename Alloc::template rebind<T>::other allocator_type;
+#else
+    typedef typename 
+            std::allocator_traits<Alloc>::template rebind_alloc<T> 
+            allocator_type;
+#endif
+    static std::size_t count(std::size_t size)
+    { return (size + sizeof(T) - 1) / sizeof(T); }
+    static void* allocate(std::size_t size)
+    {
+        allocator_type alloc;
+        return alloc.allocate(count(size));
+    }
+    static void deallocate(void* p, std::size_t size)
+    {
+        allocator_type alloc;
+        alloc.deallocate(static_cast<T*>(p), count(size));
+    }
+};
+
 } } } // End namespaces detail, iostreams, boost
 
 #ifdef BOOST_IOSTREAMS_BROKEN_OVERLOAD_RESOLUTION
@@ -96,6 +128,15 @@ public:
                              BOOST_IOSTREAMS_PUSH_ARGS )
     T& operator*() { return *this->component(); }
     T* operator->() { return this->component(); }
+
+    // Memory for stream buffers, such as the links of a chain, is obtained
+    // from Alloc.
+    static void* operator new(std::size_t size)
+    { return detail::allocated_storage<stream_buffer, Alloc>::allocate(size); }
+    static void operator delete(void* p, std::size_t size)
+    { detail::allocated_storage<stream_buffer, Alloc>::deallocate(p, size); }
+    static void* operator new(std::size_t, void* p) { return p; }
+    static void operator delete(void*, void*) { }
 private:
     void open_impl(const T& t BOOST_IOSTREAMS_PUSH_PARAMS())
         {   // Used for forwarding.
@@ -0,0 +1,145 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class template threaded_filter and the function template
+// threaded, which run an OutputFilter, and the components which follow it in
+// a chain, on a worker thread. Requires C++11 threading support.
+
+#ifndef BOOST_IOSTREAMS_THREADED_HPP_INCLUDED
+#define BOOST_IOSTREAMS_THREADED_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/config.hpp>                      // BOOST_DEDUCED_TYPENAME.
+#include <boost/iostreams/categories.hpp>
+#include <boost/iostreams/detail/ios.hpp>        // openmode, streamsize.
+#include <boost/iostreams/detail/write_behind.hpp>
+#include <boost/iostreams/operations.hpp>
+#include <boost/iostreams/pipeline.hpp>
+#include <boost/iostreams/traits.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/type_traits/is_convertible.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>  // MSVC.
+
+namespace boost { namespace iostreams {
+
+//
+// Template name: threaded_filter.
+// Template parameters:
+//      Filter - A model of OutputFilter or DualUseFilter.
+// Description: OutputFilter which passes the characters written to it to a
+//      worker thread through a bounded ring, where they are filtered by the
+//      given Filter and written to the downstream Sink. In a chain, the
+//      components following a threaded_filter therefore run on its worker
+//      thread, up to the next threaded_filter, so that wrapping several
+//      filters of a chain lets each run on its own core. Flushing and closing
+//      wait until the worker has processed all pending characters, after
+//      which the Filter is flushed or closed on the calling thread; an
+//      exception thrown on the worker thread is rethrown by the next call to
+//      write(), flush() or close(). While a non-blocking downstream Sink
+//      accepts no characters, the worker yields before retrying. Copies share
+//      their state.
+//
+template<typename Filter>
+class threaded_filter {
+private:
+    BOOST_STATIC_ASSERT(is_filter<Filter>::value);
+    BOOST_STATIC_ASSERT((
+        is_convertible<
+            BOOST_DEDUCED_TYPENAME mode_of<Filter>::type,
+            output
+        >::value
+    ));
+public:
+    typedef typename char_type_of<Filter>::type  char_type;
+    struct category
+        : output,
+          filter_tag,
+          multichar_tag,
+          closable_tag,
+          flushable_tag
+        { };
+    BOOST_STATIC_CONSTANT(std::streamsize, default_ring_size = 64 * 1024);
+    explicit threaded_filter( const Filter& filter,
+                              std::streamsize ring_size = default_ring_size )
+        : pimpl_(new impl(filter, ring_size))
+        { }
+
+    template<typename Sink>
+    std::streamsize write(Sink& snk, const char_type* s, std::streamsize n)
+    {
+        impl& i = *pimpl_;
+        if (!i.engine_.started())
+            i.engine_.start(writer<Sink>(i, snk));
+        i.engine_.write(s, n);
+        return n;
+    }
+
+    template<typename Sink>
+    bool flush(Sink& snk)
+    {
+        pimpl_->engine_.drain();
+        return iostreams::flush(pimpl_->filter_, snk);
+    }
+
+    template<typename Sink>
+    void close(Sink& snk) { pimpl_->engine_.close(closer<Sink>(*pimpl_, snk)); }
+
+    Filter& filter() { return pimpl_->filter_; }
+private:
+    struct impl {
+        impl(const Filter& filter, std::streamsize ring_size)
+            : filter_(filter), engine_(ring_size)
+            { }
+        Filter                           filter_;
+        detail::write_behind<char_type>  engine_;  // Destroyed first.
+    };
+
+    template<typename Sink>
+    struct writer {
+        writer(impl& i, Sink& snk) : impl_(i), snk_(snk) { }
+        std::streamsize operator()(const char_type* s, std::streamsize n) const
+        { return iostreams::write(impl_.filter_, snk_, s, n); }
+        impl&  impl_;
+        Sink&  snk_;
+    };
+    template<typename Sink>
+    struct closer {
+        closer(impl& i, Sink& snk) : impl_(i), snk_(snk) { }
+        void operator()() const
+        { iostreams::close(impl_.filter_, snk_, BOOST_IOS::out); }
+        impl&  impl_;
+        Sink&  snk_;
+    };
+
+    shared_ptr<impl> pimpl_;
+};
+BOOST_IOSTREAMS_PIPABLE(threaded_filter, 1)
+
+//
+// Template name: threaded.
+// Template parameters:
+//      Filter - A model of OutputFilter or DualUseFilter.
+// Description: Returns an instance of an appropriate specialization of
+//      threaded_filter.
+//
+template<typename Filter>
+threaded_filter<Filter>
+threaded( const Filter& f,
+          std::streamsize ring_size =
+              threaded_filter<Filter>::default_ring_size )
+{ return threaded_filter<Filter>(f, ring_size); }
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
+
+#endif // #ifndef BOOST_IOSTREAMS_THREADED_HPP_INCLUDED
@@ -0,0 +1,154 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Defines the class template utf8_codecvt, a codecvt facet which converts
+// between UTF-8 and UTF-16 or UTF-32.
+
+#ifndef BOOST_IOSTREAMS_UTF8_CODECVT_HPP_INCLUDED
+#define BOOST_IOSTREAMS_UTF8_CODECVT_HPP_INCLUDED
+
+#if defined(_MSC_VER)
+# pragma once
+#endif
+
+#include <boost/iostreams/detail/config/wide_streams.hpp>
+#if defined(BOOST_IOSTREAMS_NO_WIDE_STREAMS) || \
+    defined(BOOST_IOSTREAMS_NO_LOCALE) \
+    /**/
+# error code conversion not supported on this platform
+#endif
+
+#include <cstddef>                          // size_t.
+#include <cwchar>                           // mbstate_t.
+#include <locale>                           // codecvt_base.
+#include <boost/iostreams/detail/codecvt_helper.hpp>
+#include <boost/iostreams/detail/utf8.hpp>
+#include <boost/static_assert.hpp>
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp>
+
+namespace boost { namespace iostreams {
+
+// Determines how utf8_codecvt treats ill-formed input.
+enum utf8_error_policy {
+    utf8_strict,    // Report an error.
+    utf8_replace    // Substitute U+FFFD REPLACEMENT CHARACTER.
+};
+
+//
+// Template name: utf8_codecvt.
+// Description: codecvt facet which converts between UTF-8 and UTF-16, if
+//      Intern is two bytes wide, or UTF-32, if Intern is four bytes wide.
+//      Ill-formed UTF-8, unpaired surrogates and values above U+10FFFF are
+//      rejected or replaced, according to Policy. code_converter converts
+//      directly, without calls through the facet, for specializations of
+//      utf8_codecvt and for the standard UTF-8 facets.
+// Template parameters:
+//      Intern - The internal character type: wchar_t, char16_t or char32_t.
+//      Policy - The utf8_error_policy.
+//
+template<typename Intern, utf8_error_policy Policy = utf8_strict>
+class utf8_codecvt
+    : public detail::codecvt_helper<Intern, char, std::mbstate_t>
+{
+private:
+    typedef detail::codecvt_helper<Intern, char, std::mbstate_t> base_type;
+    BOOST_STATIC_ASSERT(sizeof(Intern) == 2 || sizeof(Intern) == 4);
+public:
+    BOOST_STATIC_CONSTANT(int, bits = sizeof(Intern) == 2 ? 16 : 32);
+    explicit utf8_codecvt(std::size_t refs = 0) : base_type(refs) { }
+protected:
+    std::codecvt_base::result
+    do_in( std::mbstate_t&, const char* first1, const char* last1,
+           const char*& next1, Intern* first2, Intern* last2,
+           Intern*& next2 ) const
+    {
+        next1 = first1;
+        next2 = first2;
+        return result(
+                   detail::utf8_decode<bits>( next1, last1, next2, last2,
+                                              Policy == utf8_replace )
+               );
+    }
+
+    std::codecvt_base::result
+    do_out( std::mbstate_t&, const Intern* first1, const Intern* last1,
+            const Intern*& next1, char* first2, char* last2,
+            char*& next2 ) const
+    {
+        next1 = first1;
+        next2 = first2;
+        return result(
+                   detail::utf8_encode<bits>( next1, last1, next2, last2,
+                                              Policy == utf8_replace )
+               );
+    }
+
+    std::codecvt_base::result
+    do_unshift(std::mbstate_t&, char* first2, char*, char*& next2) const
+    {
+        next2 = first2;
+        return std::codecvt_base::noconv;
+    }
+
+    bool do_always_noconv() const throw() { return false; }
+
+    int do_encoding() const throw() { return 0; }
+
+    int do_max_length() const throw() { return 4; }
+
+    // Returns the number of bytes which convert to at most len2 characters.
+    // The state is non-const, as in C++11, since the base class is a
+    // standard specialization of codecvt.
+    int do_length( std::mbstate_t&, const char* first1, const char* last1,
+                   std::size_t len2 ) const throw()
+    {
+        const char* next1 = first1;
+        Intern      buf[64];
+        while (len2 > 0) {
+            std::size_t amt = len2 < 64 ? len2 : 64;
+            Intern*     next2 = buf;
+            detail::utf_status status =
+                detail::utf8_decode<bits>( next1, last1, next2, buf + amt,
+                                           Policy == utf8_replace );
+            len2 -= static_cast<std::size_t>(next2 - buf);
+            if (status != detail::utf_short_output || next2 == buf)
+                break;
+        }
+        return static_cast<int>(next1 - first1);
+    }
+private:
+    static std::codecvt_base::result result(detail::utf_status status)
+    {
+        switch (status) {
+        case detail::utf_ok:
+            return std::codecvt_base::ok;
+        case detail::utf_invalid:
+            return std::codecvt_base::error;
+        default:
+            return std::codecvt_base::partial;
+        }
+    }
+};
+
+namespace detail {
+
+template<typename Intern, utf8_error_policy Policy>
+struct utf8_conversion< utf8_codecvt<Intern, Policy> >
+    : utf8_conversion_impl<
+          utf8_codecvt<Intern, Policy>::bits,
+          Policy == utf8_replace
+      >
+    { };
+
+} // End namespace detail.
+
+} } // End namespaces iostreams, boost.
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
+
+#endif // #ifndef BOOST_IOSTREAMS_UTF8_CODECVT_HPP_INCLUDED
@@ -40,6 +40,7 @@
 # endif
 #else
 # include <sys/types.h>  // mode_t.
+# include <time.h>       // clock_gettime.
 # include <unistd.h>     // low-level file i/o.
 #endif
 
@@ -72,15 +73,21 @@ struct file_descriptor_impl {
     std::streamsize read(char* s, std::streamsize n);
     std::streamsize write(const char* s, std::streamsize n);
     std::streampos seek(stream_offset off, BOOST_IOS::seekdir way);
+    void sync();
+    bool sync_due(std::streamsize n);
     static file_handle invalid_handle();
-    file_handle  handle_;
-    int          flags_;
+    static boost::intmax_t milliseconds();
+    file_handle       handle_;
+    int               flags_;
+    file_sync_policy  policy_;
+    boost::intmax_t   unsynced_;   // Characters written since the last sync.
+    boost::intmax_t   last_sync_;  // Time of the last sync, in milliseconds.
 };
 
 //------------------Implementation of file_descriptor_impl--------------------//
 
 file_descriptor_impl::file_descriptor_impl() 
-    : handle_(invalid_handle()), flags_(0) 
+    : handle_(invalid_handle()), flags_(0), unsynced_(0), last_sync_(0)
     { }
 
 file_descriptor_impl::~file_descriptor_impl() 
@@ -271,6 +278,7 @@ void file_descriptor_impl::close_impl(bool close_flag, bool throw_) {
     //  Even if the close fails, we want nothing more to do with the handle
         handle_ = invalid_handle();
         flags_ = 0;
+        unsynced_ = 0;
         if (!success && throw_)
             throw_system_failure("failed closing file");
     }
@@ -361,6 +369,43 @@ std::streampos file_descriptor_impl::seek
 #endif // #ifdef BOOST_IOSTREAMS_WINDOWS
 }
 
+void file_descriptor_impl::sync()
+{
+    if (handle_ == invalid_handle())
+        return;
+#ifdef BOOST_IOSTREAMS_WINDOWS
+    if (!::FlushFileBuffers(handle_))
+        throw_system_failure("failed synchronizing file");
+#else // #ifdef BOOST_IOSTREAMS_WINDOWS
+    int result;
+    do {
+# if defined(_POSIX_SYNCHRONIZED_IO) && _POSIX_SYNCHRONIZED_IO > 0 && \
+     !defined(__APPLE__)
+        result = ::fdatasync(handle_);
+# else
+        result = ::fsync(handle_);
+# endif
+    } while (result == -1 && errno == EINTR);
+    if (result == -1)
+        throw_system_failure("failed synchronizing file");
+#endif // #ifdef BOOST_IOSTREAMS_WINDOWS
+}
+
+// Records that n characters have been written, and returns true if the
+// policy calls for a sync
+bool file_descriptor_impl::sync_due(std::streamsize n)
+{
+    if (policy_.mode != file_sync_policy::periodic)
+        return false;
+    unsynced_ += n;
+    if (policy_.bytes > 0 && unsynced_ >= policy_.bytes)
+        return true;
+    if (policy_.milliseconds <= 0)
+        return false;
+    boost::intmax_t elapsed = milliseconds() - last_sync_;
+    return elapsed >= policy_.milliseconds || elapsed < 0;  // < 0: wrapped.
+}
+
 // Returns the value stored in a file_handle variable when no file is open
 file_handle file_descriptor_impl::invalid_handle()
 {
@@ -371,6 +416,19 @@ file_handle file_descriptor_impl::invalid_handle()
 #endif
 }
 
+// Returns the value of a monotonic clock, in milliseconds
+boost::intmax_t file_descriptor_impl::milliseconds()
+{
+#ifdef BOOST_IOSTREAMS_WINDOWS
+    return static_cast<boost::intmax_t>(::GetTickCount());
+#else
+    timespec ts;
+    ::clock_gettime(CLOCK_MONOTONIC, &ts);
+    return static_cast<boost::intmax_t>(ts.tv_sec) * 1000 +
+           ts.tv_nsec / 1000000;
+#endif
+}
+
 } // End namespace detail.
 
 //------------------Implementation of file_descriptor-------------------------//
@@ -447,19 +505,61 @@ void file_descriptor::open(const char* path, BOOST_IOS::openmode mode)
 
 bool file_descriptor::is_open() const { return pimpl_->is_open(); }
 
-void file_descriptor::close() { pimpl_->close(); }
+void file_descriptor::close()
+{
+    if ( pimpl_->policy_.mode == file_sync_policy::periodic &&
+         pimpl_->unsynced_ != 0 && pimpl_->is_open() )
+    {
+        try {
+            commit();
+        } catch (...) {
+            try { pimpl_->close(); } catch (...) { }
+            throw;
+        }
+    }
+    pimpl_->close();
+}
 
 std::streamsize file_descriptor::read(char_type* s, std::streamsize n)
 { return pimpl_->read(s, n); }
 
 std::streamsize file_descriptor::write(const char_type* s, std::streamsize n)
-{ return pimpl_->write(s, n); }
+{
+    std::streamsize result = pimpl_->write(s, n);
+    if (pimpl_->sync_due(result))
+        commit();
+    return result;
+}
 
 std::streampos file_descriptor::seek(stream_offset off, BOOST_IOS::seekdir way)
 { return pimpl_->seek(off, way); }
 
 detail::file_handle file_descriptor::handle() const { return pimpl_->handle_; }
 
+void file_descriptor::set_sync_policy(const file_sync_policy& policy)
+{
+    pimpl_->policy_ = policy;
+    pimpl_->last_sync_ = impl_type::milliseconds();
+}
+
+file_sync_policy file_descriptor::sync_policy() const
+{ return pimpl_->policy_; }
+
+void file_descriptor::sync() { pimpl_->sync(); }
+
+void file_descriptor::commit()
+{
+    impl_type& impl = *pimpl_;
+    if (impl.policy_.mode == file_sync_policy::none)
+        return;
+    if (impl.policy_.group)
+        impl.policy_.group->commit(*this);
+    else
+        impl.sync();
+    impl.unsynced_ = 0;
+    impl.last_sync_ = impl_type::milliseconds();
+}
+
 void file_descriptor::init() { pimpl_.reset(new impl_type); }
 
 void file_descriptor::open(
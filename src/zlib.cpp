@@ -91,7 +91,8 @@ void zlib_error::check BOOST_PREVENT_MACRO_SUBSTITUTION(int error)
 namespace detail {
 
 zlib_base::zlib_base()
-    : stream_(new z_stream), calculate_crc_(false), crc_(0), crc_imp_(0),
+    : stream_(new z_stream), calculate_crc_(false), strategy_(0),
+      crc_(0), crc_imp_(0),
       total_in_(0), total_out_(0)
     { }
 
@@ -139,6 +140,22 @@ int zlib_base::xinflate(int flush)
     return ::inflate(static_cast<z_stream*>(stream_), flush);
 }
 
+bool zlib_base::set_level(int level)
+{
+    // Withhold the remaining input so that deflateParams only has to flush
+    // the data compressed at the old level; if the output buffer is too
+    // small for that, the change is retried on the next call.
+    z_stream* s = static_cast<z_stream*>(stream_);
+    zlib::uint avail_in = s->avail_in;
+    s->avail_in = 0;
+    int result = deflateParams(s, level, strategy_);
+    s->avail_in = avail_in;
+    if (result == Z_BUF_ERROR)
+        return false;
+    zlib_error::check BOOST_PREVENT_MACRO_SUBSTITUTION(result);
+    return true;
+}
+
 void zlib_base::reset(bool compress, bool realloc)
 {
     z_stream* s = static_cast<z_stream*>(stream_);
@@ -159,6 +176,7 @@ void zlib_base::do_init
       void* derived )
 {
     calculate_crc_ = p.calculate_crc;
+    strategy_ = p.strategy;
     z_stream* s = static_cast<z_stream*>(stream_);
 
     // Current interface for customizing memory management 
@@ -56,7 +56,8 @@ void zstd_error::check BOOST_PREVENT_MACRO_SUBSTITUTION(size_t error)
 namespace detail {
 
 zstd_base::zstd_base()
-    : cstream_(ZSTD_createCStream()), dstream_(ZSTD_createDStream()), in_(new ZSTD_inBuffer), out_(new ZSTD_outBuffer), eof_(0)
+    : cstream_(ZSTD_createCStream()), dstream_(ZSTD_createDStream()), in_(new ZSTD_inBuffer), out_(new ZSTD_outBuffer), eof_(0),
+      restarting_(false)
     { }
 
 zstd_base::~zstd_base()
@@ -121,6 +122,24 @@ int zstd_base::inflate(int action)
     return action == zstd::finish && in->size == 0 && out->pos == 0 ? zstd::stream_end : zstd::okay;
 }
 
+bool zstd_base::set_level(uint32_t level)
+{
+    // Without worker threads, zstd applies a new level only at the start
+    // of a frame, so the current frame is ended first.
+    ZSTD_CStream *s = static_cast<ZSTD_CStream *>(cstream_);
+    ZSTD_outBuffer *out = static_cast<ZSTD_outBuffer *>(out_);
+    size_t result = ZSTD_endStream(s, out);
+    zstd_error::check BOOST_PREVENT_MACRO_SUBSTITUTION(result);
+    restarting_ = result != 0;
+    if (restarting_)
+        return false;
+    level_ = level;
+    zstd_error::check BOOST_PREVENT_MACRO_SUBSTITUTION(
+        ZSTD_initCStream(s, level_)
+    );
+    return true;
+}
+
 void zstd_base::reset(bool compress, bool realloc)
 {
     ZSTD_inBuffer *in = static_cast<ZSTD_inBuffer *>(in_);
@@ -130,10 +149,11 @@ void zstd_base::reset(bool compress, bool realloc)
         memset(in, 0, sizeof(*in));
         memset(out, 0, sizeof(*out));
         eof_ = 0;
+        restarting_ = false;
 
         zstd_error::check BOOST_PREVENT_MACRO_SUBSTITUTION(
             compress ?
-                ZSTD_initCStream(static_cast<ZSTD_CStream *>(cstream_), level) :
+                ZSTD_initCStream(static_cast<ZSTD_CStream *>(cstream_), level_) :
                 ZSTD_initDStream(static_cast<ZSTD_DStream *>(dstream_))
         );
     }
@@ -151,10 +171,10 @@ void zstd_base::do_init
     memset(out, 0, sizeof(*out));
     eof_ = 0;
 
-    level = p.level;
+    level_ = p.level;
     zstd_error::check BOOST_PREVENT_MACRO_SUBSTITUTION(
         compress ?
-            ZSTD_initCStream(static_cast<ZSTD_CStream *>(cstream_), level) :
+            ZSTD_initCStream(static_cast<ZSTD_CStream *>(cstream_), level_) :
             ZSTD_initDStream(static_cast<ZSTD_DStream *>(dstream_))
     );
 }
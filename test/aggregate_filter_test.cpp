@@ -0,0 +1,123 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/aggregate.hpp>
+#include <boost/iostreams/filter/test.hpp>
+#include <boost/iostreams/write.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace boost::iostreams;
+using boost::unit_test::test_suite;
+
+// Sorts the lines of its input, examining the input in place.
+class line_sorter : public range_aggregate_filter<char> {
+public:
+    explicit line_sorter(std::streamsize memory_limit = 0)
+        : range_aggregate_filter<char>(memory_limit)
+        { }
+private:
+    typedef pair<const char*, const char*> line;
+    struct less_line {
+        bool operator()(const line& x, const line& y) const
+        { return lexicographical_compare(x.first, x.second, y.first, y.second); }
+    };
+    void do_filter_range( const char* first, const char* last,
+                          spool_type& dest )
+    {
+        vector<line> lines;
+        while (first != last) {
+            const char* next = find(first, last, '\n');
+            lines.push_back(line(first, next));
+            first = next == last ? last : next + 1;
+        }
+        sort(lines.begin(), lines.end(), less_line());
+        for (vector<line>::size_type z = 0; z < lines.size(); ++z) {
+            dest.write(lines[z].first, lines[z].second - lines[z].first);
+            dest.write("\n", 1);
+        }
+    }
+};
+
+// Reverses its input.
+class reverser : public aggregate_filter<char> {
+private:
+    void do_filter(const vector_type& src, vector_type& dest)
+    { dest.assign(src.rbegin(), src.rend()); }
+};
+
+string make_input()
+{
+    string input;
+    unsigned int seed = 7;
+    for (int z = 0; z < 2000; ++z) {
+        seed = seed * 1103515245 + 12345;
+        int len = (seed >> 16) % 30;
+        for (int y = 0; y < len; ++y) {
+            seed = seed * 1103515245 + 12345;
+            input += static_cast<char>('a' + (seed >> 16) % 26);
+        }
+        input += '\n';
+    }
+    return input;
+}
+
+void range_test()
+{
+    string input = make_input();
+    vector<string> lines;
+    string::size_type pos = 0, next;
+    while ((next = input.find('\n', pos)) != string::npos) {
+        lines.push_back(input.substr(pos, next - pos + 1));
+        pos = next + 1;
+    }
+    sort(lines.begin(), lines.end());
+    string output;
+    for (vector<string>::size_type z = 0; z < lines.size(); ++z)
+        output += lines[z];
+
+    // Unbounded, within the limit, and spilled to a temporary file.
+    BOOST_CHECK(test_input_filter(line_sorter(), input, output));
+    BOOST_CHECK(test_output_filter(line_sorter(), input, output));
+    BOOST_CHECK(test_input_filter(line_sorter(1 << 20), input, output));
+    BOOST_CHECK(test_input_filter(line_sorter(100), input, output));
+    BOOST_CHECK(test_output_filter(line_sorter(100), input, output));
+}
+
+void vector_test()
+{
+    string input = make_input();
+    string output(input.rbegin(), input.rend());
+    BOOST_CHECK(test_input_filter(reverser(), input, output));
+    BOOST_CHECK(test_output_filter(reverser(), input, output));
+    BOOST_CHECK(test_output_filter(line_sorter(100), string(), string()));
+}
+
+void copy_test()
+{
+    // A filter may be copied until its data is moved to a temporary file.
+    string                         input = make_input(), result;
+    back_insert_device<string>     snk(result);
+    line_sorter                    f(100);
+    boost::iostreams::write(f, snk, input.data(), 50);
+    line_sorter                    g(f);
+    boost::iostreams::write(f, snk, input.data() + 50, 1000);
+    BOOST_CHECK_THROW(line_sorter h(f), BOOST_IOSTREAMS_FAILURE);
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("aggregate_filter test");
+    test->add(BOOST_TEST_CASE(&range_test));
+    test->add(BOOST_TEST_CASE(&vector_test));
+    test->add(BOOST_TEST_CASE(&copy_test));
+    return test;
+}
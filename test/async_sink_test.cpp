@@ -0,0 +1,214 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <cctype>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <boost/iostreams/async_sink.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/device/pipe.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/filters.hpp"
+#include "detail/temp_file.hpp"
+#include "detail/verification.hpp"
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Sink which appends to a shared string, blocking while its gate is closed
+class gated_sink : public sink {
+public:
+    gated_sink() : state_(new state) { }
+    std::streamsize write(const char* s, std::streamsize n)
+    {
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        while (!state_->open)
+            state_->cond.wait(lock);
+        state_->data.append(s, static_cast<string::size_type>(n));
+        return n;
+    }
+    void open()
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->open = true;
+        state_->cond.notify_all();
+    }
+    string data() const
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        return state_->data;
+    }
+private:
+    struct state {
+        state() : open(false) { }
+        std::mutex               mutex;
+        std::condition_variable  cond;
+        bool                     open;
+        string                   data;
+    };
+    boost::shared_ptr<state> state_;
+};
+
+// Sink which throws once a given number of characters have been written
+struct throwing_sink : public sink {
+    explicit throwing_sink(std::streamsize limit) : limit_(limit) { }
+    std::streamsize write(const char*, std::streamsize n)
+    {
+        if (n > limit_)
+            throw std::runtime_error("throwing_sink");
+        limit_ -= n;
+        return n;
+    }
+    std::streamsize limit_;
+};
+
+void write_async_sink_test()
+{
+    string expected;
+    for (int z = 0; z < data_reps; ++z)
+        expected.append(narrow_data(), data_length());
+
+    {
+        temp_file temp;
+        {
+            filtering_ostream out;
+            out.push(tolower_filter());
+            out.push(async_sink<file_sink>(file_sink(temp.name(), out_mode)));
+            write_data_in_chunks(out);
+        }
+        string lower(expected);
+        for (string::size_type z = 0; z < lower.size(); ++z)
+            lower[z] = static_cast<char>(std::tolower((unsigned char) lower[z]));
+        BOOST_CHECK_MESSAGE(
+            compare_container_and_file(lower, temp.name()),
+            "failed writing to async_sink in chunks"
+        );
+    }
+
+    // A ring smaller than the characters written
+    {
+        string dest;
+        {
+            stream< async_sink< back_insert_device<string> > >
+                out(async_sink< back_insert_device<string> >(
+                        io::back_inserter(dest), 16 ));
+            write_data_in_chars(out);
+        }
+        BOOST_CHECK(dest == expected);
+    }
+}
+
+void write_behind_test()
+{
+    // Writing returns before the underlying Sink is written; flushing waits
+    // for it
+    gated_sink              slow;
+    async_sink<gated_sink>  snk(slow, 1024);
+    BOOST_CHECK_EQUAL(snk.write("hello", 5), 5);
+    BOOST_CHECK(slow.data().empty());
+    std::thread opener([slow]() mutable {
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        slow.open();
+    });
+    BOOST_CHECK(snk.flush());
+    BOOST_CHECK(slow.data() == "hello");
+    opener.join();
+    snk.write(" world", 6);
+    snk.close();
+    BOOST_CHECK(slow.data() == "hello world");
+
+    // A closed async_sink may be reused
+    snk.write("!", 1);
+    snk.close();
+    BOOST_CHECK(snk.sink().data() == "hello world!");
+}
+
+void would_block_test()
+{
+    // A non-blocking Sink which is often full
+    string expected;
+    for (int z = 0; z < data_reps; ++z)
+        expected.append(narrow_data(), data_length());
+    pair<pipe_sink, pipe_source>  p = make_pipe(8, pipe_non_blocking_write);
+    string                        dest;
+    std::thread                   reader([&] {
+        char buf[8];
+        std::streamsize amt;
+        while ((amt = p.second.read(buf, 8)) != -1)
+            dest.append(buf, static_cast<string::size_type>(amt));
+    });
+    {
+        stream< async_sink<pipe_sink> >
+            out(async_sink<pipe_sink>(p.first, 16));
+        write_data_in_chunks(out);
+    }
+    reader.join();
+    BOOST_CHECK(dest == expected);
+}
+
+void error_test()
+{
+    string data(100, 'x');
+
+    // An exception on the background thread is rethrown by the next call
+    {
+        async_sink<throwing_sink> snk(throwing_sink(50), 16);
+        BOOST_CHECK_THROW(
+            { snk.write(data.data(), 100); snk.flush(); },
+            std::runtime_error
+        );
+        BOOST_CHECK_THROW(snk.write(data.data(), 1), std::runtime_error);
+        BOOST_CHECK_THROW(snk.close(), std::runtime_error);
+    }
+
+    // After close() the error is cleared
+    {
+        async_sink<throwing_sink> snk(throwing_sink(50), 1024);
+        snk.write(data.data(), 100);
+        BOOST_CHECK_THROW(snk.close(), std::runtime_error);
+        snk.sink().limit_ = 100;
+        BOOST_CHECK_NO_THROW(snk.write(data.data(), 100));
+        BOOST_CHECK_NO_THROW(snk.close());
+    }
+
+    // A ring size which is not positive is rejected
+    BOOST_CHECK_THROW(
+        async_sink<throwing_sink>(throwing_sink(50), 0),
+        std::invalid_argument
+    );
+    BOOST_CHECK_THROW(
+        async_sink<throwing_sink>(throwing_sink(50), -1),
+        std::invalid_argument
+    );
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("async_sink test");
+    test->add(BOOST_TEST_CASE(&write_async_sink_test));
+    test->add(BOOST_TEST_CASE(&write_behind_test));
+    test->add(BOOST_TEST_CASE(&would_block_test));
+    test->add(BOOST_TEST_CASE(&error_test));
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
@@ -0,0 +1,250 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <boost/iostreams/async_tee.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/temp_file.hpp"
+#include "detail/verification.hpp"
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Sink which appends to a shared string, blocking while its gate is closed
+class gated_sink : public sink {
+public:
+    gated_sink() : state_(new state) { }
+    std::streamsize write(const char* s, std::streamsize n)
+    {
+        std::unique_lock<std::mutex> lock(state_->mutex);
+        while (!state_->open)
+            state_->cond.wait(lock);
+        state_->data.append(s, static_cast<string::size_type>(n));
+        return n;
+    }
+    void open()
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        state_->open = true;
+        state_->cond.notify_all();
+    }
+    string data() const
+    {
+        std::lock_guard<std::mutex> lock(state_->mutex);
+        return state_->data;
+    }
+private:
+    struct state {
+        state() : open(false) { }
+        std::mutex               mutex;
+        std::condition_variable  cond;
+        bool                     open;
+        string                   data;
+    };
+    boost::shared_ptr<state> state_;
+};
+
+// Sink which throws once a given number of characters have been written
+struct throwing_sink : public sink {
+    explicit throwing_sink(std::streamsize limit) : limit_(limit) { }
+    std::streamsize write(const char*, std::streamsize n)
+    {
+        if (n > limit_)
+            throw std::runtime_error("throwing_sink");
+        limit_ -= n;
+        return n;
+    }
+    std::streamsize limit_;
+};
+
+string make_data(int count)
+{
+    string result;
+    for (int z = 0; z < count; ++z)
+        result += static_cast<char>('a' + z % 26);
+    return result;
+}
+
+void fan_out_test()
+{
+    temp_file      temp;
+    string         dest1, dest2;
+    stringstream   dest3;
+    {
+        async_tee tee(100);
+        tee.add(io::back_inserter(dest1));
+        tee.add(io::back_inserter(dest2), block_on_full, 250);
+        tee.add(dest3);
+        tee.add(file_sink(temp.name(), out_mode));
+        BOOST_CHECK_EQUAL(tee.size(), 4u);
+        filtering_ostream out(tee);
+        write_data_in_chunks(out);
+    }
+    string expected;
+    for (int z = 0; z < data_reps; ++z)
+        expected.append(narrow_data(), data_length());
+    BOOST_CHECK(dest1 == expected);
+    BOOST_CHECK(dest2 == expected);
+    BOOST_CHECK(dest3.str() == expected);
+    BOOST_CHECK_MESSAGE(
+        compare_container_and_file(expected, temp.name()),
+        "failed writing to async_tee branch in chunks"
+    );
+
+    // Flushing waits for all branches
+    {
+        string    dest1, dest2;
+        async_tee tee(64);
+        tee.add(io::back_inserter(dest1));
+        tee.add(io::back_inserter(dest2));
+        tee.write("hello", 5);
+        BOOST_CHECK(tee.flush());
+        BOOST_CHECK(dest1 == "hello" && dest2 == "hello");
+        tee.write(" world", 6);
+        tee.close();
+        BOOST_CHECK(dest1 == "hello world" && dest2 == "hello world");
+
+        // A closed async_tee may be reused
+        tee.write("!", 1);
+        tee.close();
+        BOOST_CHECK(dest1 == "hello world!" && dest2 == "hello world!");
+    }
+}
+
+void policy_test()
+{
+    const int   chunk_size = 16;
+    const int   chunks = 10;
+    string      data = make_data(chunk_size * chunks);
+
+    // A stalled branch with drop_on_full loses all but the chunk it is
+    // writing, without delaying the other branches
+    {
+        string      fast;
+        gated_sink  slow;
+        async_tee   tee(chunk_size);
+        tee.add(slow, drop_on_full, chunk_size);
+        tee.add(io::back_inserter(fast));
+        tee.write(data.data(), static_cast<std::streamsize>(data.size()));
+        BOOST_CHECK_EQUAL(tee.dropped(0), chunk_size * (chunks - 1));
+        BOOST_CHECK_EQUAL(tee.dropped(1), 0);
+        slow.open();
+        tee.close();
+        BOOST_CHECK(fast == data);
+        BOOST_CHECK(slow.data() == data.substr(0, chunk_size));
+    }
+
+    // A stalled branch with spill_on_full receives every character in order
+    {
+        string      fast;
+        gated_sink  slow;
+        async_tee   tee(chunk_size);
+        tee.add(slow, spill_on_full, chunk_size);
+        tee.add(io::back_inserter(fast));
+        tee.write(data.data(), static_cast<std::streamsize>(data.size()));
+        slow.open();
+        tee.write(data.data(), static_cast<std::streamsize>(data.size()));
+        tee.close();
+        BOOST_CHECK_EQUAL(tee.dropped(0), 0);
+        BOOST_CHECK(fast == data + data);
+        BOOST_CHECK(slow.data() == data + data);
+    }
+
+    // Wide characters pass through the spill file unchanged
+    {
+        wstring     wdata(data.begin(), data.end()), dest;
+        wasync_tee  tee(chunk_size);
+        tee.add(io::back_inserter(dest), spill_on_full, chunk_size);
+        for (int z = 0; z < 20; ++z)
+            tee.write(wdata.data(), static_cast<std::streamsize>(wdata.size()));
+        tee.close();
+        BOOST_CHECK_EQUAL(dest.size(), 20 * wdata.size());
+        BOOST_CHECK(dest.substr(19 * wdata.size()) == wdata);
+    }
+
+    // A branch with block_on_full holds the writer back until it catches up
+    {
+        gated_sink   slow;
+        async_tee    tee(chunk_size);
+        tee.add(slow, block_on_full, chunk_size);
+        std::thread opener([slow]() mutable {
+            std::this_thread::sleep_for(std::chrono::milliseconds(20));
+            slow.open();
+        });
+        for (int z = 0; z < 50; ++z)
+            tee.write(data.data(), static_cast<std::streamsize>(data.size()));
+        tee.close();
+        opener.join();
+        BOOST_CHECK_EQUAL(tee.dropped(0), 0);
+        BOOST_CHECK_EQUAL(slow.data().size(), 50 * data.size());
+    }
+}
+
+void error_test()
+{
+    string data = make_data(100);
+
+    // An exception on a worker thread is rethrown by flush() and close()
+    {
+        string     dest;
+        async_tee  tee(10);
+        tee.add(io::back_inserter(dest));
+        tee.add(throwing_sink(50));
+        tee.write(data.data(), 100);
+        BOOST_CHECK_THROW(tee.flush(), std::runtime_error);
+        BOOST_CHECK_THROW(tee.write(data.data(), 100), std::runtime_error);
+        BOOST_CHECK_THROW(tee.close(), std::runtime_error);
+    }
+
+    // The error is reported through a stream
+    {
+        string             dest;
+        async_tee          tee(10);
+        filtering_ostream  out;
+        tee.add(throwing_sink(50));
+        tee.add(io::back_inserter(dest));
+        out.push(tee, 0);
+        out.exceptions(BOOST_IOS::badbit);
+        bool thrown = false;
+        try {
+            out.write(data.data(), 100);
+            out.flush();
+            out.write(data.data(), 100);
+        } catch (const std::exception&) {
+            thrown = true;
+        }
+        BOOST_CHECK(thrown);
+        out.exceptions(BOOST_IOS::goodbit);
+    }
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("async_tee test");
+    test->add(BOOST_TEST_CASE(&fan_out_test));
+    test->add(BOOST_TEST_CASE(&policy_test));
+    test->add(BOOST_TEST_CASE(&error_test));
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
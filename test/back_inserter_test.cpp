@@ -0,0 +1,156 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/sequence.hpp"
+#include "detail/verification.hpp"
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Returns the test data repeated data_reps times.
+string test_string()
+{
+    string result;
+    for (int z = 0; z < data_reps; ++z)
+        result.append(narrow_data(), data_length());
+    return result;
+}
+
+void expected_size_test()
+{
+    {
+        string                      dest;
+        back_insert_device<string>  out = io::back_inserter(dest, 100000);
+        BOOST_CHECK(dest.capacity() >= 100000);
+        out.write("abc", 3);
+        BOOST_CHECK_EQUAL(dest, "abc");
+    }
+    {
+        vector<char>  dest;
+        direct_back_inserter(dest, 5000);
+        BOOST_CHECK(dest.empty());
+        BOOST_CHECK(dest.capacity() >= 5000);
+    }
+    {
+        // The hint is ignored by containers without reserve()
+        list<char>  dest;
+        io::back_inserter(dest, 1000).write("ab", 2);
+        BOOST_CHECK_EQUAL(string(dest.begin(), dest.end()), "ab");
+    }
+}
+
+void back_insert_device_test()
+{
+    string        data = test_string();
+    vector<char>  dest;
+    {
+        stream< back_insert_device< vector<char> > >  out(dest);
+        write_data_in_chunks(out);
+    }
+    BOOST_CHECK(string(dest.begin(), dest.end()) == data);
+}
+
+template<typename Container>
+void direct_test(const Container& prefix)
+{
+    typedef direct_back_insert_device<Container>  device_type;
+    string     data = test_string();
+    string     expected = string(prefix.begin(), prefix.end()) + data;
+
+    // In chars and in chunks, with and without an expected size
+    for (int hint = 0; hint < 2; ++hint) {
+        for (int chunks = 0; chunks < 2; ++chunks) {
+            Container dest(prefix);
+            {
+                stream<device_type> out(dest, hint ? data.size() : 0);
+                if (chunks)
+                    write_data_in_chunks(out);
+                else
+                    write_data_in_chars(out);
+            }
+            BOOST_CHECK_MESSAGE(
+                string(dest.begin(), dest.end()) == expected,
+                "failed writing " << (chunks ? "chunks" : "chars")
+            );
+        }
+    }
+
+    // Output larger than the device's window, with and without reallocation
+    for (int hint = 0; hint < 2; ++hint) {
+        Container  dest(prefix);
+        string     large;
+        {
+            stream<device_type> out(dest, hint ? 100 * data.size() : 0);
+            for (int z = 0; z < 100; ++z) {
+                out.write(data.data(), static_cast<streamsize>(z));
+                out.write(data.data(), static_cast<streamsize>(data.size()));
+                large.append(data.data(), z);
+                large += data;
+            }
+        }
+        BOOST_CHECK(
+            string(dest.begin(), dest.end()) ==
+                string(prefix.begin(), prefix.end()) + large
+        );
+    }
+
+    // Through a chain
+    {
+        Container dest(prefix);
+        {
+            filtering_ostream out(direct_back_inserter(dest));
+            write_data_in_chunks(out);
+        }
+        BOOST_CHECK(string(dest.begin(), dest.end()) == expected);
+    }
+
+    // The unused capacity is discarded on close, even if nothing is written
+    {
+        Container dest(prefix);
+        stream<device_type> out(dest);
+        BOOST_CHECK(dest.size() >= prefix.size());
+        out.close();
+        BOOST_CHECK(dest == prefix);
+    }
+
+    // copy() uses the member function write()
+    {
+        Container dest(prefix);
+        io::copy( array_source(data.data(), data.size()),
+                  direct_back_inserter(dest) );
+        BOOST_CHECK(string(dest.begin(), dest.end()) == expected);
+    }
+}
+
+void direct_back_insert_device_test()
+{
+    direct_test(string());
+    direct_test(string("prefix"));
+    direct_test(vector<char>());
+    direct_test(vector<char>(100, 'x'));
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("back_inserter test");
+    test->add(BOOST_TEST_CASE(&expected_size_test));
+    test->add(BOOST_TEST_CASE(&back_insert_device_test));
+    test->add(BOOST_TEST_CASE(&direct_back_insert_device_test));
+    return test;
+}
@@ -0,0 +1,240 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <cctype>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/iostreams/buffer_pool.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/iostreams/stream_buffer.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/filters.hpp"
+
+#ifndef BOOST_IOSTREAMS_NO_BUFFER_POOL
+# include <thread>
+#endif
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Pool which forwards to buffer_pool, keeping count of the blocks and bytes
+// outstanding
+struct counting_pool {
+    static void* allocate(std::size_t size)
+    {
+        ++allocations;
+        bytes += size;
+        return buffer_pool::allocate(size);
+    }
+    static void deallocate(void* p, std::size_t size)
+    {
+        --allocations;
+        bytes -= size;
+        buffer_pool::deallocate(p, size);
+    }
+    static int          allocations;
+    static std::size_t  bytes;
+};
+
+int          counting_pool::allocations = 0;
+std::size_t  counting_pool::bytes = 0;
+
+typedef pooled_allocator<char, counting_pool>                    counting_alloc;
+typedef filtering_stream<
+            output, char, std::char_traits<char>, counting_alloc
+        >                                                        counting_ostream;
+typedef filtering_stream<
+            output, char, std::char_traits<char>,
+            pooled_allocator<char>
+        >                                                        pooled_ostream;
+
+string write_pooled(const string& data)
+{
+    string          dest;
+    pooled_ostream  out;
+    out.push(tolower_filter());
+    out.push(tolower_multichar_filter(), 128);
+    out.push(io::back_inserter(dest));
+    out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    out.reset();
+    return dest;
+}
+
+void pooled_allocator_test()
+{
+    // Chain links, their buffers and the chain itself are obtained from the
+    // pool and returned to it
+    {
+        string dest;
+        {
+            counting_ostream out;
+            BOOST_CHECK(counting_pool::allocations > 0);
+            int before = counting_pool::allocations;
+            out.push(tolower_filter(), 100);
+            out.push(io::back_inserter(dest));
+
+            // Each push allocates a link, a list node and, for indirect
+            // stream buffers, a character buffer
+            BOOST_CHECK(counting_pool::allocations >= before + 5);
+            BOOST_CHECK(counting_pool::bytes >= 100);
+            out << "HELLO";
+            out.pop();
+            out.push(io::back_inserter(dest));
+            out << " WORLD";
+        }
+        BOOST_CHECK_EQUAL(counting_pool::allocations, 0);
+        BOOST_CHECK_EQUAL(counting_pool::bytes, 0u);
+        BOOST_CHECK(dest == "hello world");
+    }
+
+    // Stream buffers allocated individually
+    {
+        typedef stream_buffer<
+                    back_insert_device<string>,
+                    std::char_traits<char>, counting_alloc
+                > streambuf_type;
+        string          dest;
+        streambuf_type* buf = new streambuf_type(io::back_inserter(dest), 64);
+        BOOST_CHECK_EQUAL(counting_pool::allocations, 2);
+        buf->sputn("abc", 3);
+        delete buf;
+        BOOST_CHECK_EQUAL(counting_pool::allocations, 0);
+        BOOST_CHECK(dest == "abc");
+    }
+
+    // Streams
+    {
+        string dest;
+        {
+            stream<
+                back_insert_device<string>,
+                std::char_traits<char>, counting_alloc
+            > out(io::back_inserter(dest), 64);
+            BOOST_CHECK_EQUAL(counting_pool::allocations, 1);
+            out << "stream";
+        }
+        BOOST_CHECK_EQUAL(counting_pool::allocations, 0);
+        BOOST_CHECK(dest == "stream");
+    }
+
+    {
+        string data(10000, 'A');
+        BOOST_CHECK(write_pooled(data) == string(10000, 'a'));
+    }
+}
+
+#ifndef BOOST_IOSTREAMS_NO_BUFFER_POOL
+
+void buffer_pool_recycling_test()
+{
+    // Freed blocks are reused by the same thread
+    void* p = buffer_pool::allocate(100);
+    buffer_pool::deallocate(p, 100);
+    void* q = buffer_pool::allocate(128);
+    BOOST_CHECK(p == q);
+    buffer_pool::deallocate(q, 128);
+
+    // Blocks larger than max_block_size are not pooled
+    std::size_t size = buffer_pool::max_block_size + 1;
+    p = buffer_pool::allocate(size);
+    buffer_pool::deallocate(p, size);
+
+    // Blocks cached by a thread are returned to the shared free lists when
+    // the thread exits
+    buffer_pool::release();
+    BOOST_CHECK_EQUAL(buffer_pool::size(), 0u);
+    std::thread t([] {
+        void* p = buffer_pool::allocate(1000);
+        buffer_pool::deallocate(p, 1000);
+    });
+    t.join();
+    BOOST_CHECK_EQUAL(buffer_pool::size(), 1024u);
+    p = buffer_pool::allocate(1000);
+    BOOST_CHECK_EQUAL(buffer_pool::size(), 0u);
+    buffer_pool::deallocate(p, 1000);
+}
+
+void buffer_pool_capacity_test()
+{
+    std::size_t capacity = buffer_pool::capacity();
+    buffer_pool::release();
+    buffer_pool::set_capacity(4096);
+    BOOST_CHECK_EQUAL(buffer_pool::capacity(), 4096u);
+
+    // Blocks overflowing the thread cache are retained only up to the
+    // capacity
+    vector<void*> blocks;
+    for (int z = 0; z < 1000; ++z)
+        blocks.push_back(buffer_pool::allocate(64));
+    for (int z = 0; z < 1000; ++z)
+        buffer_pool::deallocate(blocks[z], 64);
+    BOOST_CHECK(buffer_pool::size() > 0);
+    BOOST_CHECK(buffer_pool::size() <= 4096u);
+
+    // Lowering the capacity frees blocks
+    buffer_pool::set_capacity(0);
+    BOOST_CHECK_EQUAL(buffer_pool::size(), 0u);
+    buffer_pool::set_capacity(capacity);
+}
+
+void buffer_pool_threads_test()
+{
+    const int thread_count = 4;
+    string data;
+    for (int z = 0; z < 500; ++z)
+        data += "AbCdEfGhIj";
+    string expected(data);
+    for (string::size_type z = 0; z < expected.size(); ++z)
+        expected[z] = static_cast<char>(std::tolower(expected[z]));
+
+    // Streams are created and destroyed concurrently; blocks are freed by a
+    // thread other than the one which allocated them
+    vector<int>                 failures(thread_count, 0);
+    vector<void*>               handoff(thread_count * 100);
+    vector<std::thread>         threads;
+    for (int t = 0; t < thread_count; ++t) {
+        threads.push_back(std::thread([&, t] {
+            for (int z = 0; z < 200; ++z)
+                if (write_pooled(data) != expected)
+                    ++failures[t];
+            for (int z = 0; z < 100; ++z)
+                handoff[t * 100 + z] = buffer_pool::allocate(z * 97);
+        }));
+    }
+    for (int t = 0; t < thread_count; ++t)
+        threads[t].join();
+    for (int z = 0; z < thread_count * 100; ++z)
+        buffer_pool::deallocate(handoff[z], (z % 100) * 97);
+    for (int t = 0; t < thread_count; ++t)
+        BOOST_CHECK_EQUAL(failures[t], 0);
+}
+
+#endif // #ifndef BOOST_IOSTREAMS_NO_BUFFER_POOL
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("buffer_pool test");
+    test->add(BOOST_TEST_CASE(&pooled_allocator_test));
+#ifndef BOOST_IOSTREAMS_NO_BUFFER_POOL
+    test->add(BOOST_TEST_CASE(&buffer_pool_recycling_test));
+    test->add(BOOST_TEST_CASE(&buffer_pool_capacity_test));
+    test->add(BOOST_TEST_CASE(&buffer_pool_threads_test));
+#endif
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
@@ -0,0 +1,186 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Verifies that reads and writes larger than the stream buffer are passed to
+// the underlying component directly, without changing the data transferred.
+
+#ifndef BOOST_IOSTREAMS_TEST_BULK_IO_HPP_INCLUDED
+#define BOOST_IOSTREAMS_TEST_BULK_IO_HPP_INCLUDED
+
+#include <algorithm>
+#include <string>
+#include <vector>
+#include <boost/iostreams/concepts.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/test/test_tools.hpp>
+#include "detail/filters.hpp"
+#include "detail/temp_file.hpp"
+
+namespace boost { namespace iostreams { namespace test {
+
+// Source and Sink which record the size of each request
+class recording_source : public source {
+public:
+    recording_source(const std::string& data, std::vector<std::streamsize>& log)
+        : data_(data), pos_(0), log_(&log)
+        { }
+    std::streamsize read(char* s, std::streamsize n)
+    {
+        log_->push_back(n);
+        std::streamsize avail =
+            static_cast<std::streamsize>(data_.size() - pos_);
+        if (avail == 0)
+            return -1;
+        std::streamsize amt = (std::min)(n, avail);
+        std::copy(data_.data() + pos_, data_.data() + pos_ + amt, s);
+        pos_ += static_cast<std::string::size_type>(amt);
+        return amt;
+    }
+private:
+    std::string                    data_;
+    std::string::size_type         pos_;
+    std::vector<std::streamsize>*  log_;
+};
+
+class recording_sink : public sink {
+public:
+    recording_sink(std::string& data, std::vector<std::streamsize>& log)
+        : data_(&data), log_(&log)
+        { }
+    std::streamsize write(const char* s, std::streamsize n)
+    {
+        log_->push_back(n);
+        data_->append(s, static_cast<std::string::size_type>(n));
+        return n;
+    }
+private:
+    std::string*                   data_;
+    std::vector<std::streamsize>*  log_;
+};
+
+inline std::string bulk_test_data(std::string::size_type size)
+{
+    std::string result(size, ' ');
+    for (std::string::size_type z = 0; z < size; ++z)
+        result[z] = static_cast<char>('a' + (z * 7) % 26);
+    return result;
+}
+
+} } } // End namespaces test, iostreams, boost.
+
+void bulk_read_test()
+{
+    using namespace std;
+    using namespace boost::iostreams;
+    using namespace boost::iostreams::test;
+
+    const streamsize              buffer_size = 100;
+    const string                  data = bulk_test_data(10000);
+    vector<streamsize>            log;
+
+    {
+        stream<recording_source> in( recording_source(data, log),
+                                     buffer_size );
+        string result(data.size(), ' ');
+
+        // A small read fills the buffer; a large read then takes the
+        // remaining buffered characters and reads the rest directly
+        in.read(&result[0], 10);
+        in.read(&result[10], 5000);
+        BOOST_CHECK_EQUAL(in.gcount(), 5000);
+        BOOST_CHECK_EQUAL(log.size(), 2u);
+        BOOST_CHECK(log.size() == 2 && log[1] == 5000 - (buffer_size - 10));
+
+        // Putback after a direct read
+        in.putback(result[5009]);
+        in.putback(result[5008]);
+        BOOST_CHECK(in.good());
+        in.read(&result[5008], data.size() - 5008);
+        BOOST_CHECK(in.gcount() == static_cast<streamsize>(data.size() - 5008));
+        BOOST_CHECK(result == data);
+        BOOST_CHECK(in.get() == EOF);
+    }
+
+    // Filters
+    {
+        filtering_istream in;
+        in.push(toupper_multichar_filter(), buffer_size);
+        in.push(recording_source(data, log), buffer_size);
+        string result(data.size(), ' '), expected(data);
+        for (string::size_type z = 0; z < expected.size(); ++z)
+            expected[z] = static_cast<char>(std::toupper(expected[z]));
+        in.read(&result[0], 1);
+        in.read(&result[1], static_cast<streamsize>(data.size() - 1));
+        BOOST_CHECK(in.gcount() == static_cast<streamsize>(data.size() - 1));
+        BOOST_CHECK(result == expected);
+    }
+}
+
+void bulk_write_test()
+{
+    using namespace std;
+    using namespace boost::iostreams;
+    using namespace boost::iostreams::test;
+
+    const streamsize              buffer_size = 100;
+    const string                  data = bulk_test_data(10000);
+    string                        dest;
+    vector<streamsize>            log;
+
+    {
+        stream<recording_sink> out(recording_sink(dest, log), buffer_size);
+
+        // Buffered characters are written before a large request, which is
+        // then passed to the sink directly
+        out.write(data.data(), 10);
+        out.write(data.data() + 10, 5000);
+        BOOST_CHECK_EQUAL(log.size(), 2u);
+        BOOST_CHECK(log.size() == 2 && log[0] == 10 && log[1] == 5000);
+        out.write(data.data() + 5010, 20);
+        out.write( data.data() + 5030,
+                   static_cast<streamsize>(data.size() - 5030) );
+        out.flush();
+        BOOST_CHECK(dest == data);
+    }
+
+    // Filters
+    {
+        dest.clear();
+        filtering_ostream out;
+        out.push(tolower_multichar_filter(), buffer_size);
+        out.push(recording_sink(dest, log), buffer_size);
+        string upper(data);
+        for (string::size_type z = 0; z < upper.size(); ++z)
+            upper[z] = static_cast<char>(std::toupper(upper[z]));
+        out.write(upper.data(), 1);
+        out.write(upper.data() + 1, static_cast<streamsize>(upper.size() - 1));
+        out.flush();
+        BOOST_CHECK(dest == data);
+    }
+
+    // Seekable devices, alternating reads and writes
+    {
+        temp_file     temp;
+        stream<file>  io( file(temp.name(), in_mode | out_mode | BOOST_IOS::trunc),
+                          buffer_size );
+        io.write(data.data(), static_cast<streamsize>(data.size()));
+        io.seekg(0, BOOST_IOS::beg);
+        string result(data.size(), ' ');
+        io.read(&result[0], 1000);
+        BOOST_CHECK(io.tellg() == streampos(1000));
+        io.seekp(0, BOOST_IOS::cur);
+        io.write(data.data(), 1000);
+        io.seekg(1000, BOOST_IOS::beg);
+        io.read(&result[1000], static_cast<streamsize>(data.size() - 1000));
+        BOOST_CHECK(result.substr(0, 1000) == data.substr(0, 1000));
+        BOOST_CHECK(result.substr(1000, 1000) == data.substr(0, 1000));
+        BOOST_CHECK(result.substr(2000) == data.substr(2000));
+    }
+}
+
+#endif // #ifndef BOOST_IOSTREAMS_TEST_BULK_IO_HPP_INCLUDED
@@ -28,6 +28,7 @@
 # endif
 #endif
 #include <boost/iostreams/stream.hpp>
+#include <boost/iostreams/utf8_codecvt.hpp>
 #include <boost/test/test_tools.hpp>
 #include <boost/test/unit_test.hpp>
 #include "detail/closable.hpp"
@@ -252,6 +253,7 @@ bool codecvt_test()
 void code_converter_test()
 {
     BOOST_CHECK((codecvt_test<utf8_codecvt_facet<wchar_t, char> >()));
+    BOOST_CHECK((codecvt_test< io::utf8_codecvt<wchar_t> >()));
     BOOST_CHECK(codecvt_test<null_padded_codecvt>());
     BOOST_CHECK(codecvt_test<stateless_null_padded_codecvt>());
 #ifdef BOOST_IOSTREAMS_USE_DINKUM_COREX
@@ -6,6 +6,9 @@
 // See http://www.boost.org/libs/iostreams for documentation.
 
 #include <cctype>
+#include <fstream>
+#include <sstream>
+#include <string>
 #include <boost/iostreams/copy.hpp>
 #include <boost/iostreams/device/file.hpp>
 #include <boost/iostreams/device/null.hpp>
@@ -89,10 +92,87 @@ void write_counter()
     }
 }
 
+void large_counts()
+{
+    const stream_offset big = static_cast<stream_offset>(1) << 40;
+    counter     cnt(big, big);
+    null_sink   snk;
+    cnt.write(snk, "abc\n", 4);
+    BOOST_CHECK(cnt.lines() == big + 1);
+    BOOST_CHECK(cnt.characters() == big + 4);
+}
+
+void line_index_counter()
+{
+    // Build lines of varying length, long enough to exercise the vectorized
+    // newline count.
+    std::string data;
+    std::vector<stream_offset> starts;
+    for (int z = 0; z < 1000; ++z) {
+        starts.push_back(static_cast<stream_offset>(data.size()));
+        data.append(static_cast<std::string::size_type>((z * 37) % 101), 'a');
+        data += '\n';
+    }
+    temp_file  file;
+    {
+        std::ofstream out(file.name().c_str(), BOOST_IOS::binary);
+        out.write(data.data(), static_cast<std::streamsize>(data.size()));
+    }
+
+    for (stream_offset interval = 1; interval < 70; interval += 17) {
+        counter    cnt(0, 0, interval);
+        null_sink  snk;
+        for (std::size_t off = 0, inc = 1; off < data.size(); off += inc) {
+            inc = (std::min)(data.size() - off, (off * 7) % 300 + 1);
+            cnt.write(snk, data.data() + off, static_cast<std::streamsize>(inc));
+        }
+        BOOST_CHECK_EQUAL(cnt.lines(), 1000);
+        BOOST_CHECK_EQUAL(cnt.characters(), (stream_offset) data.size());
+
+        const line_index& index = cnt.index();
+        BOOST_CHECK_EQUAL(index.size(), 1000 / interval + 1);
+        for (std::size_t z = 0; z < index.size(); ++z) {
+            stream_offset line = index.line(z);
+            BOOST_CHECK_EQUAL( index.offset(z),
+                               line < 1000 ?
+                                   starts[line] :
+                                   (stream_offset) data.size() );
+        }
+
+        // Save the index, reload it and use it to locate a line.
+        std::stringstream sidecar;
+        index.save(sidecar);
+        line_index loaded;
+        loaded.load(sidecar);
+        BOOST_CHECK_EQUAL(loaded.interval(), interval);
+        BOOST_REQUIRE_EQUAL(loaded.size(), index.size());
+        for (stream_offset line = 0; line < 1000; line += 97) {
+            std::size_t pos = loaded.find(line);
+            BOOST_REQUIRE(pos != loaded.size());
+            BOOST_CHECK(loaded.line(pos) <= line);
+            BOOST_CHECK(line - loaded.line(pos) < interval);
+            filtering_istream in;
+            in.push(file_source(file.name(), in_mode));
+            in.seekg(loaded.offset(pos), BOOST_IOS::beg);
+            std::string text;
+            for (stream_offset l = loaded.line(pos); l <= line; ++l)
+                std::getline(in, text);
+            BOOST_CHECK_EQUAL(text.size(), (std::size_t) (line * 37) % 101);
+        }
+    }
+
+    std::stringstream bad("not an index");
+    line_index index;
+    BOOST_CHECK_THROW(index.load(bad), BOOST_IOSTREAMS_FAILURE);
+    BOOST_CHECK_THROW(counter(0, 0, -1), BOOST_IOSTREAMS_FAILURE);
+}
+
 test_suite* init_unit_test_suite(int, char* []) 
 {
     test_suite* test = BOOST_TEST_SUITE("counter test");
     test->add(BOOST_TEST_CASE(&read_counter));
     test->add(BOOST_TEST_CASE(&write_counter));
+    test->add(BOOST_TEST_CASE(&large_counts));
+    test->add(BOOST_TEST_CASE(&line_index_counter));
     return test;
 }
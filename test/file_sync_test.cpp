@@ -0,0 +1,301 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include <boost/iostreams/detail/config/windows_posix.hpp>
+#include <boost/iostreams/device/file_descriptor.hpp>
+#include <boost/iostreams/device/group_commit.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/temp_file.hpp"
+#include "detail/verification.hpp"
+
+#ifndef BOOST_IOSTREAMS_WINDOWS
+# include <unistd.h>  // pipe.
+#endif
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+
+// file_sync_group which counts the commits it performs
+struct counting_group : file_sync_group {
+    counting_group() : commits(0) { }
+    void commit(file_descriptor& fd)
+    {
+        ++commits;
+        fd.sync();
+    }
+    int commits;
+};
+
+void sync_policy_test()
+{
+    // Without a policy, commit() does nothing
+    {
+        temp_file             temp;
+        counting_group        group;
+        file_descriptor_sink  snk(temp.name());
+        BOOST_CHECK(snk.sync_policy().mode == file_sync_policy::none);
+        snk.set_sync_policy(
+            file_sync_policy(file_sync_policy::none, 0, 0, &group) );
+        snk.write("hello", 5);
+        snk.commit();
+        BOOST_CHECK_NO_THROW(snk.sync());
+        snk.close();
+        BOOST_CHECK_EQUAL(group.commits, 0);
+        BOOST_CHECK_NO_THROW(snk.sync());  // No-op once closed
+    }
+
+    // With on_commit, data are synchronized on each commit() only
+    {
+        temp_file             temp;
+        counting_group        group;
+        file_descriptor_sink  snk(temp.name());
+        snk.set_sync_policy(
+            file_sync_policy(file_sync_policy::on_commit, 0, 0, &group) );
+        for (int z = 0; z < 10; ++z)
+            snk.write("0123456789", 10);
+        BOOST_CHECK_EQUAL(group.commits, 0);
+        snk.commit();
+        BOOST_CHECK_EQUAL(group.commits, 1);
+        snk.close();
+        BOOST_CHECK_EQUAL(group.commits, 1);
+    }
+
+    // Without a group, commit() synchronizes the file directly
+    {
+        temp_file             temp;
+        file_descriptor_sink  snk(temp.name());
+        snk.set_sync_policy(file_sync_policy(file_sync_policy::on_commit));
+        snk.write("hello", 5);
+        BOOST_CHECK_NO_THROW(snk.commit());
+        snk.close();
+        string expected("hello");
+        BOOST_CHECK(compare_container_and_file(expected, temp.name()));
+    }
+}
+
+void periodic_sync_test()
+{
+    // Every given number of characters, and on close
+    {
+        temp_file             temp;
+        counting_group        group;
+        file_descriptor_sink  snk(temp.name());
+        snk.set_sync_policy(
+            file_sync_policy(file_sync_policy::periodic, 10, 0, &group) );
+        for (int z = 0; z < 5; ++z)
+            snk.write("abcd", 4);
+        BOOST_CHECK_EQUAL(group.commits, 1);
+        snk.close();
+        BOOST_CHECK_EQUAL(group.commits, 2);
+    }
+
+    // Not before the given number of milliseconds has passed
+    {
+        temp_file             temp;
+        counting_group        group;
+        stream<file_descriptor_sink> out(temp.name());
+        out->set_sync_policy(
+            file_sync_policy(file_sync_policy::periodic, 0, 3600000, &group) );
+        out << "abcd" << flush;
+        out << "efgh" << flush;
+        BOOST_CHECK_EQUAL(group.commits, 0);
+        out.close();
+        BOOST_CHECK_EQUAL(group.commits, 1);
+        string expected("abcdefgh");
+        BOOST_CHECK(compare_container_and_file(expected, temp.name()));
+    }
+
+    // On the first write after it has passed; the sleep lasts at least
+    // as long as the interval, measured by a monotonic clock
+    {
+        temp_file             temp;
+        counting_group        group;
+        stream<file_descriptor_sink> out(temp.name());
+        out->set_sync_policy(
+            file_sync_policy(file_sync_policy::periodic, 0, 2, &group) );
+        this_thread::sleep_for(chrono::milliseconds(5));
+        out << "abcd" << flush;
+        BOOST_CHECK_EQUAL(group.commits, 1);
+        out.close();
+        BOOST_CHECK_EQUAL(group.commits, 1);
+    }
+}
+
+// group_commit whose synchronizations wait until the test opens a gate
+class gated_group_commit : public group_commit {
+public:
+    gated_group_commit() : open_(false), entered_(0), syncs_(0) { }
+    void open()
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        open_ = true;
+        cond_.notify_all();
+    }
+
+    // Waits until a synchronization has started.
+    void wait_entered()
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        while (entered_ == 0)
+            cond_.wait(lock);
+    }
+    int syncs() const
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        return syncs_;
+    }
+private:
+    void sync(file_descriptor& fd)
+    {
+        std::unique_lock<std::mutex> lock(mutex_);
+        ++entered_;
+        cond_.notify_all();
+        while (!open_)
+            cond_.wait(lock);
+        ++syncs_;
+        lock.unlock();
+        fd.sync();
+    }
+    mutable std::mutex       mutex_;
+    std::condition_variable  cond_;
+    bool                     open_;
+    int                      entered_;
+    int                      syncs_;
+};
+
+void group_commit_test()
+{
+    // Commits made while a batch is being synchronized share the next batch
+    {
+        const int              threads = 5;
+        gated_group_commit     group;
+        vector<temp_file>      temps(threads);
+        vector<std::thread>    workers;
+        vector<boost::shared_ptr<file_descriptor_sink> > sinks;
+        for (int t = 0; t < threads; ++t) {
+            sinks.push_back(boost::shared_ptr<file_descriptor_sink>(
+                new file_descriptor_sink(temps[t].name()) ));
+            sinks[t]->set_sync_policy(
+                file_sync_policy(file_sync_policy::on_commit, 0, 0, &group) );
+        }
+        for (int t = 0; t < threads; ++t) {
+            file_descriptor_sink* snk = sinks[t].get();
+            workers.push_back(std::thread([snk]() {
+                snk->write("record\n", 7);
+                snk->commit();
+            }));
+            if (t == 0)
+                group.wait_entered();  // The first thread leads batch 1.
+        }
+        while (group.pending() != threads - 1)
+            this_thread::yield();
+        group.open();
+        for (int t = 0; t < threads; ++t)
+            workers[t].join();
+        BOOST_CHECK_EQUAL(group.batches(), 2u);
+        BOOST_CHECK_EQUAL(group.syncs(), threads);
+    }
+
+    // A file committed by several threads is synchronized once per batch
+    {
+        gated_group_commit    group;
+        temp_file             temp, other;
+        file_descriptor_sink  leader(other.name());
+        file_descriptor_sink  first(temp.name());
+        file_descriptor_sink  second(first.handle(), never_close_handle);
+        file_sync_policy      policy(file_sync_policy::on_commit, 0, 0, &group);
+        leader.set_sync_policy(policy);
+        first.set_sync_policy(policy);
+        second.set_sync_policy(policy);
+        std::thread lead([&leader]() { leader.commit(); });
+        group.wait_entered();
+        std::thread a([&first]() { first.commit(); });
+        std::thread b([&second]() { second.commit(); });
+        while (group.pending() != 2)
+            this_thread::yield();
+        group.open();
+        lead.join();
+        a.join();
+        b.join();
+        BOOST_CHECK_EQUAL(group.batches(), 2u);
+        BOOST_CHECK_EQUAL(group.syncs(), 2);
+    }
+
+    // Many threads committing many times
+    {
+        const int threads = 8, commits = 20;
+        group_commit          group;
+        vector<temp_file>     temps(threads);
+        vector<std::thread>   workers;
+        for (int t = 0; t < threads; ++t) {
+            string name = temps[t].name();
+            workers.push_back(std::thread([&group, name]() {
+                file_descriptor_sink snk(name);
+                snk.set_sync_policy( file_sync_policy(
+                    file_sync_policy::on_commit, 0, 0, &group) );
+                for (int z = 0; z < commits; ++z) {
+                    snk.write("record\n", 7);
+                    snk.commit();
+                }
+                snk.close();
+            }));
+        }
+        for (int t = 0; t < threads; ++t)
+            workers[t].join();
+        string expected;
+        for (int z = 0; z < commits; ++z)
+            expected += "record\n";
+        for (int t = 0; t < threads; ++t)
+            BOOST_CHECK(compare_container_and_file(expected, temps[t].name()));
+    }
+}
+
+void group_commit_error_test()
+{
+#ifndef BOOST_IOSTREAMS_WINDOWS
+    // A pipe cannot be synchronized
+    int fds[2];
+    BOOST_REQUIRE(::pipe(fds) == 0);
+    group_commit          group;
+    file_descriptor_sink  snk(fds[1], close_handle);
+    file_descriptor_source src(fds[0], close_handle);
+    snk.set_sync_policy(
+        file_sync_policy(file_sync_policy::on_commit, 0, 0, &group) );
+    snk.write("x", 1);
+    BOOST_CHECK_THROW(snk.commit(), BOOST_IOSTREAMS_FAILURE);
+    BOOST_CHECK_EQUAL(group.batches(), 1u);
+
+    // The group remains usable
+    temp_file             temp;
+    file_descriptor_sink  file(temp.name());
+    file.set_sync_policy(
+        file_sync_policy(file_sync_policy::on_commit, 0, 0, &group) );
+    file.write("x", 1);
+    BOOST_CHECK_NO_THROW(file.commit());
+    BOOST_CHECK_EQUAL(group.batches(), 2u);
+#endif
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("file sync test");
+    test->add(BOOST_TEST_CASE(&sync_policy_test));
+    test->add(BOOST_TEST_CASE(&periodic_sync_test));
+    test->add(BOOST_TEST_CASE(&group_commit_test));
+    test->add(BOOST_TEST_CASE(&group_commit_error_test));
+    return test;
+}
@@ -24,6 +24,7 @@
 #include "seek_test.hpp"
 #include "putback_test.hpp"
 #include "filtering_stream_flush_test.hpp"
+#include "bulk_io_test.hpp"
 
 using boost::unit_test::test_suite;
 
@@ -48,5 +49,7 @@ test_suite* init_unit_test_suite(int, char* [])
     test->add(BOOST_TEST_CASE(&seek_test));
     test->add(BOOST_TEST_CASE(&putback_test));
     test->add(BOOST_TEST_CASE(&test_filtering_ostream_flush));
+    test->add(BOOST_TEST_CASE(&bulk_read_test));
+    test->add(BOOST_TEST_CASE(&bulk_write_test));
     return test;
 }
@@ -18,7 +18,9 @@
 #include <boost/config.hpp>  // Make sure ptrdiff_t is in std.
 #include <algorithm>
 #include <cstddef>           // std::ptrdiff_t
+#include <cstdlib>           // rand.
 #include <string>
+#include <vector>
 #include <boost/iostreams/compose.hpp>
 #include <boost/iostreams/copy.hpp>
 #include <boost/iostreams/device/array.hpp>
@@ -203,6 +205,12 @@ void test_filter( grep_filter grep,
                   const std::string& input, 
                   const std::string& output );
 
+// Returns the lines of input selected by the given regular expressions,
+// tested one line at a time
+std::string grep_lines( const std::string& input, 
+                        const std::vector<regex>& patterns,
+                        int options = 0 );
+
 void grep_filter_test()
 {
     regex match_us_courthouse("\\bUnited States Courthouse\\b");
@@ -248,6 +256,123 @@ void grep_filter_test()
     }
 }
 
+void grep_fixed_string_test()
+{
+    std::string courthouse("United States Courthouse");
+
+    {
+        grep_filter grep(courthouse, grep::fixed_string);
+        test_filter(grep, addresses, us_courthouse);
+    }
+
+    {
+        grep_filter grep(courthouse, grep::fixed_string | grep::invert);
+        test_filter(grep, addresses, us_courthouse_inv);
+    }
+
+    {
+        grep_filter grep( std::string("40 Centre Street"), 
+                          grep::fixed_string | grep::whole_line );
+        grep.add(std::string("515 Rusk Street"));
+        grep.add(std::string("Rusk Street"));
+        test_filter(grep, addresses, "40 Centre Street\n515 Rusk Street\n");
+    }
+
+    {
+        // Patterns containing newlines never match
+        grep_filter grep(std::string("Street\n"), grep::fixed_string);
+        test_filter(grep, addresses, "");
+    }
+}
+
+void grep_multiple_patterns_test()
+{
+    regex match_us_courthouse("\\bUnited States Courthouse\\b");
+    regex match_state_and_zip("\\b[A-Z]{2}\\s+[0-9]{5}(-[0-9]{4})?\\b");
+    std::vector<regex> patterns;
+    patterns.push_back(match_us_courthouse);
+    patterns.push_back(match_state_and_zip);
+
+    {
+        grep_filter grep(match_us_courthouse);
+        grep.add(match_state_and_zip);
+        test_filter(grep, addresses, grep_lines(addresses, patterns));
+    }
+
+    {
+        grep_filter grep(std::string("Suite"), grep::fixed_string);
+        grep.add(match_us_courthouse);
+        std::vector<regex> suite(patterns.begin(), patterns.begin() + 1);
+        suite.push_back(regex("Suite"));
+        test_filter(grep, addresses, grep_lines(addresses, suite));
+    }
+
+    {
+        // A copy is unaffected by patterns added to the original
+        grep_filter first(match_us_courthouse, 
+                          regex_constants::match_default, grep::invert);
+        grep_filter second(first);
+        first.add(match_state_and_zip);
+        test_filter( first, addresses, 
+                     grep_lines(addresses, patterns, grep::invert) );
+        test_filter(second, addresses, us_courthouse_inv);
+    }
+}
+
+void grep_prefilter_test()
+{
+    // Each pattern either contains a required literal, located by the 
+    // prefilter, or none; the result must be the same either way
+    const char* patterns[] = {
+        "a+b", "x?yz", "[0-9]+ St", "(ab)+yz", "a.b", "b{2,}c", "^ab", "b$",
+        "zy*x", "a{0,2}bc", "(?:ab|ba)z", "\\d\\d", "a\\.b", "c[ab]+c",
+        "\\<ab", "ab\\>", "\\`ab", "b\\'"
+    };
+    const char alphabet[] = "abcxyz .0123456789St\n\n";
+    std::srand(0);
+    std::string input;
+    for (int z = 0; z < 20000; ++z)
+        input += alphabet[std::rand() % (sizeof(alphabet) - 1)];
+    for (std::size_t z = 0; z < sizeof(patterns) / sizeof(patterns[0]); ++z) {
+        std::vector<regex> re(1, regex(patterns[z]));
+        for (int options = 0; options < 4; ++options) {
+            grep_filter grep(re[0], regex_constants::match_default, options);
+            test_filter(grep, input, grep_lines(input, re, options));
+        }
+    }
+
+    // Zero-width assertions written as punctuation escapes are not literals
+    const std::string words = "x foo y\nbar\n";
+    test_filter(grep_filter(regex("\\<foo")), words, "x foo y\n");
+    test_filter(grep_filter(regex("foo\\>")), words, "x foo y\n");
+    test_filter(grep_filter(regex("\\`foo")), "foo\nbar\n", "foo\n");
+}
+
+std::string grep_lines( const std::string& input, 
+                        const std::vector<regex>& patterns,
+                        int options )
+{
+    std::string result;
+    std::string::size_type first = 0, last;
+    while (first < input.size()) {
+        if ((last = input.find('\n', first)) == std::string::npos)
+            last = input.size();  // Final line lacks a newline
+        std::string line(input, first, last - first);
+        bool matches = false;
+        for (std::size_t z = 0; z < patterns.size(); ++z)
+            if ( options & grep::whole_line ?
+                     regex_match(line, patterns[z]) :
+                     regex_search(line, patterns[z]) )
+            {
+                matches = true;
+            }
+        if (matches != ((options & grep::invert) != 0))
+            result += line + '\n';
+        first = last + 1;
+    }
+    return result;
+}
+
 void test_filter( grep_filter grep, 
                   const std::string& input, 
                   const std::string& output )
@@ -278,5 +403,8 @@ test_suite* init_unit_test_suite(int, char* [])
 {
     test_suite* test = BOOST_TEST_SUITE("grep_filter test");
     test->add(BOOST_TEST_CASE(&grep_filter_test));
+    test->add(BOOST_TEST_CASE(&grep_fixed_string_test));
+    test->add(BOOST_TEST_CASE(&grep_multiple_patterns_test));
+    test->add(BOOST_TEST_CASE(&grep_prefilter_test));
     return test;
 }
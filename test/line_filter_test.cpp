@@ -5,10 +5,12 @@
 
 // See http://www.boost.org/libs/iostreams for documentation.
 
+#include <algorithm>
 #include <cctype>
 #include <boost/iostreams/copy.hpp>
 #include <boost/iostreams/device/file.hpp>
 #include <boost/iostreams/filter/line.hpp>
+#include <boost/iostreams/filter/test.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 #include <boost/test/test_tools.hpp>
 #include <boost/test/unit_test.hpp>  
@@ -40,6 +42,23 @@ struct toupper_line_filter : line_filter {
     }
 };
 
+struct toupper_line_view_filter : line_view_filter {
+    explicit toupper_line_view_filter( bool suppress_newlines = false,
+                                       std::streamsize buffer_size =
+                                           default_device_buffer_size )
+        : line_view_filter(suppress_newlines, buffer_size)
+        { }
+    void do_filter(view_type line, std::string& out)
+    {
+        for ( view_type::size_type z = 0, len = line.size();
+              z < len; 
+              ++z )
+        {
+            out += (char) std::toupper((unsigned char) line[z]);
+        }
+    }
+};
+
 bool compare_streams_in_lines(std::istream& first, std::istream& second)
 {
     do {
@@ -87,11 +106,113 @@ void write_line_filter()
     );
 }
 
+void read_line_view_filter()
+{
+    test_file          src;
+    uppercase_file     upper;
+    filtering_istream  first;
+    first.push(toupper_line_view_filter());
+    first.push(file_source(src.name(), in_mode));
+    ifstream second(upper.name().c_str(), in_mode);
+    BOOST_CHECK_MESSAGE(
+        compare_streams_in_lines(first, second),
+        "failed reading from a line_view_filter"
+    );
+}
+
+void write_line_view_filter() 
+{
+    test_file          data;
+    temp_file          dest;
+    uppercase_file     upper;
+
+    filtering_ostream  out;
+    out.push(toupper_line_view_filter());
+    out.push(file_sink(dest.name(), out_mode));
+    copy(file_source(data.name(), in_mode), out);
+    out.reset();
+
+    ifstream first(dest.name().c_str());
+    ifstream second(upper.name().c_str());
+    BOOST_CHECK_MESSAGE(
+        compare_streams_in_lines(first, second),
+        "failed writing to a line_view_filter"
+    );
+}
+
+void line_view_filter_boundaries()
+{
+    // Lines longer than the buffer, empty lines and an unterminated final
+    // line, read and written in small non-blocking increments.
+    const std::string input = 
+        "short\n\na line which is longer than the buffer\nx\nlast";
+    const std::string output = 
+        "SHORT\n\nA LINE WHICH IS LONGER THAN THE BUFFER\nX\nLAST";
+    BOOST_CHECK(
+        test_input_filter(toupper_line_view_filter(false, 8), input, output)
+    );
+    BOOST_CHECK(
+        test_output_filter(toupper_line_view_filter(false, 8), input, output)
+    );
+    BOOST_CHECK(
+        test_input_filter(
+            toupper_line_view_filter(true, 8), input,
+            std::string("SHORTA LINE WHICH IS LONGER THAN THE BUFFERXLAST")
+        )
+    );
+    BOOST_CHECK(
+        test_output_filter(
+            toupper_line_view_filter(true, 8), input,
+            std::string("SHORTA LINE WHICH IS LONGER THAN THE BUFFERXLAST")
+        )
+    );
+}
+
+// Sink which records the size of the largest write.
+struct max_write_sink : boost::iostreams::sink {
+    max_write_sink(std::string& str, std::streamsize& max)
+        : str_(&str), max_(&max)
+        { }
+    std::streamsize write(const char* s, std::streamsize n)
+    {
+        str_->append(s, static_cast<std::size_t>(n));
+        *max_ = (std::max)(*max_, n);
+        return n;
+    }
+    std::string*      str_;
+    std::streamsize*  max_;
+};
+
+void line_view_filter_batches()
+{
+    // A single large write is filtered and passed downstream a buffer at a
+    // time, rather than all at once.
+    std::string input, output;
+    for (int z = 0; z < 100; ++z) {
+        input += "line of text\n";
+        output += "LINE OF TEXT\n";
+    }
+    std::string      dest;
+    std::streamsize  max = 0;
+    {
+        filtering_ostream out;
+        out.push(toupper_line_view_filter(false, 64), 0);
+        out.push(max_write_sink(dest, max), 0);
+        out.write(input.data(), static_cast<std::streamsize>(input.size()));
+    }
+    BOOST_CHECK(dest == output);
+    BOOST_CHECK(max > 0 && max < 128);
+}
+
 test_suite* init_unit_test_suite(int, char* []) 
 {
     test_suite* test = BOOST_TEST_SUITE("line_filter test");
     test->add(BOOST_TEST_CASE(&read_line_filter));
     test->add(BOOST_TEST_CASE(&write_line_filter));
+    test->add(BOOST_TEST_CASE(&read_line_view_filter));
+    test->add(BOOST_TEST_CASE(&write_line_view_filter));
+    test->add(BOOST_TEST_CASE(&line_view_filter_boundaries));
+    test->add(BOOST_TEST_CASE(&line_view_filter_batches));
     return test;
 }
 
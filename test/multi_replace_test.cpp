@@ -0,0 +1,173 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <map>
+#include <string>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filter/multi_replace.hpp>
+#include <boost/iostreams/filter/test.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace boost;
+using namespace boost::iostreams;
+using boost::unit_test::test_suite;
+
+typedef map<string, string> replacement_map;
+
+// Reference implementation: at each position, replaces the longest pattern
+// beginning there, if any.
+string naive_replace(const string& input, const replacement_map& map)
+{
+    string result;
+    string::size_type pos = 0;
+    while (pos < input.size()) {
+        replacement_map::const_iterator best = map.end();
+        for ( replacement_map::const_iterator it = map.begin();
+              it != map.end();
+              ++it )
+        {
+            if ( !it->first.empty() &&
+                 input.compare(pos, it->first.size(), it->first) == 0 &&
+                 (best == map.end() || it->first.size() > best->first.size()) )
+            {
+                best = it;
+            }
+        }
+        if (best != map.end()) {
+            result += best->second;
+            pos += best->first.size();
+        } else {
+            result += input[pos++];
+        }
+    }
+    return result;
+}
+
+void check(const replacement_map& map, const string& input)
+{
+    string output = naive_replace(input, map);
+    BOOST_CHECK(test_input_filter(multi_replace_filter(map), input, output));
+    BOOST_CHECK(test_output_filter(multi_replace_filter(map), input, output));
+}
+
+void basic_test()
+{
+    replacement_map map;
+    map["he"] = "HE";
+    map["she"] = "SHE";
+    map["his"] = "HIS";
+    map["hers"] = "HERS";
+    check(map, "ushers and his sheep; she hers, he his");
+    BOOST_CHECK_EQUAL(
+        naive_replace("ushers", map), string("uSHErs")
+    );
+
+    // Leftmost match wins over a longer match beginning later.
+    replacement_map overlap;
+    overlap["abcd"] = "1";
+    overlap["bc"] = "2";
+    overlap["bcdef"] = "3";
+    overlap["a"] = "4";
+    check(overlap, "abcdef abcxbcdefab abcd bcde abc");
+
+    // Replacements may be empty, longer than, or contain patterns.
+    replacement_map mixed;
+    mixed["cat"] = "";
+    mixed["dog"] = "doggerel dog";
+    mixed["x"] = "cat";
+    check(mixed, "catdog xx cacatt dodog catx");
+
+    // More distinct first characters than are compared one at a time,
+    // including characters above 127, in long runs of other characters.
+    replacement_map many;
+    const char firsts[] = "0123456789!@\x80\x9f\xe9\xff";
+    for (int z = 0; firsts[z] != 0; ++z)
+        many[string(1, firsts[z]) + "z"] = string(1, firsts[z]);
+    string input;
+    for (int z = 0; firsts[z] != 0; ++z) {
+        input += string(20 + z, 'a') + firsts[z] + "z" + firsts[z];
+        input += string(17, '\x7f') + firsts[z] + "z";
+    }
+    check(many, input);
+
+    // No patterns.
+    check(replacement_map(), "unchanged");
+}
+
+void random_test()
+{
+    unsigned int seed = 12345;
+    for (int round = 0; round < 20; ++round) {
+        replacement_map map;
+        string input;
+        int patterns = 1 + round % 7;
+        for (int z = 0; z < patterns; ++z) {
+            string pattern;
+            seed = seed * 1103515245 + 12345;
+            int len = 1 + (seed >> 16) % (1 + round);
+            for (int y = 0; y < len; ++y) {
+                seed = seed * 1103515245 + 12345;
+                pattern += static_cast<char>('a' + (seed >> 16) % 3);
+            }
+            map[pattern] = pattern.size() % 2 ? "<" + pattern + ">" : "";
+        }
+        for (int z = 0; z < 2000; ++z) {
+            seed = seed * 1103515245 + 12345;
+            input += static_cast<char>('a' + (seed >> 16) % 4);
+        }
+        check(map, input);
+    }
+}
+
+void add_test()
+{
+    multi_replace_filter first;
+    first.add("one", "1");
+    multi_replace_filter second(first);
+    second.add("two", "2");
+    first.add("one", "I");
+    BOOST_CHECK(test_input_filter(first, string("one two"), string("I two")));
+    BOOST_CHECK(test_input_filter(second, string("one two"), string("1 2")));
+    first.add("", "ignored");
+    BOOST_CHECK(test_output_filter(first, string("one two"), string("I two")));
+
+    // A filter with no patterns copies its input
+    string text(1000, 'x');
+    BOOST_CHECK(test_input_filter(multi_replace_filter(), text, text));
+    BOOST_CHECK(test_output_filter(multi_replace_filter(), text, text));
+}
+
+#ifndef BOOST_IOSTREAMS_NO_WIDE_STREAMS
+void wide_test()
+{
+    wmulti_replace_filter filter;
+    filter.add(L"\x3b1\x3b2", L"ab");
+    filter.add(L"b", L"\x3b2");
+    wstring output;
+    {
+        filtering_wostream out;
+        out.push(filter);
+        out.push(iostreams::back_inserter(output));
+        out << L"\x3b1\x3b2\x3b3 b \x3b1";
+    }
+    BOOST_CHECK(output == L"ab\x3b3 \x3b2 \x3b1");
+}
+#endif
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("multi_replace_filter test");
+    test->add(BOOST_TEST_CASE(&basic_test));
+    test->add(BOOST_TEST_CASE(&random_test));
+    test->add(BOOST_TEST_CASE(&add_test));
+#ifndef BOOST_IOSTREAMS_NO_WIDE_STREAMS
+    test->add(BOOST_TEST_CASE(&wide_test));
+#endif
+    return test;
+}
@@ -217,6 +217,33 @@ void write_newline_filter()
     BOOST_CHECK(my_test_output_filter(newline_filter(newline::mac), mixed, mac));
 }
 
+// Verify that a CR-LF sequence is translated correctly when it is split
+// between two calls to write().
+void split_newline_filter()
+{
+    using namespace io;
+
+    const std::string input = "line\r\nline\r\r\nline\rline\nline\r";
+    const int targets[] = { newline::posix, newline::dos, newline::mac };
+    const char* outputs[] = {
+        "line\nline\n\nline\nline\nline\n",
+        "line\r\nline\r\n\r\nline\r\nline\r\nline\r\n",
+        "line\rline\r\rline\rline\rline\r"
+    };
+    for (int i = 0; i < 3; ++i) {
+        for (std::size_t j = 0; j <= input.size(); ++j) {
+            std::string output;
+            back_insert_device<std::string> sink(output);
+            newline_filter filter(targets[i]);
+            filter.write(sink, input.data(), static_cast<std::streamsize>(j));
+            filter.write( sink, input.data() + j, 
+                          static_cast<std::streamsize>(input.size() - j) );
+            filter.close(sink, BOOST_IOS::out);
+            BOOST_CHECK_EQUAL(output, outputs[i]);
+        }
+    }
+}
+
 void test_input_against_flags(int flags, const std::string& input, bool read)
 {
     if (read) {
@@ -480,6 +507,7 @@ test_suite* init_unit_test_suite(int, char* [])
     test_suite* test = BOOST_TEST_SUITE("newline_filter test");
     test->add(BOOST_TEST_CASE(&read_newline_filter));
     test->add(BOOST_TEST_CASE(&write_newline_filter));
+    test->add(BOOST_TEST_CASE(&split_newline_filter));
     test->add(BOOST_TEST_CASE(&read_newline_checker));
     test->add(BOOST_TEST_CASE(&write_newline_checker));
     return test;
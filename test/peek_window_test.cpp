@@ -0,0 +1,203 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <cctype>
+#include <string>
+#include <utility>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/filters.hpp"
+#include "detail/temp_file.hpp"
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+
+typedef std::pair<const char*, const char*> window_type;
+
+// Source which returns at most 7 characters from each call to read()
+class trickle_source : public source {
+public:
+    explicit trickle_source(const string& data) : data_(data), pos_(0) { }
+    std::streamsize read(char* s, std::streamsize n)
+    {
+        if (pos_ == data_.size())
+            return -1;
+        std::streamsize amt =
+            (std::min)( (std::min)(n, std::streamsize(7)),
+                        static_cast<std::streamsize>(data_.size() - pos_) );
+        data_.copy(s, static_cast<string::size_type>(amt), pos_);
+        pos_ += static_cast<string::size_type>(amt);
+        return amt;
+    }
+private:
+    string                  data_;
+    string::size_type       pos_;
+};
+
+string peek_test_data()
+{
+    string result;
+    for (int z = 0; z < 500; ++z) {
+        result += "token";
+        result += static_cast<char>('0' + z % 10);
+        result += z % 7 == 0 ? '\n' : ' ';
+    }
+    return result;
+}
+
+// Splits the input into whitespace-separated tokens in place, requesting
+// windows of the given size
+template<typename Stream>
+string tokenize(Stream& in, std::streamsize window)
+{
+    string result;
+    for (;;) {
+        window_type w = in.peek_window(window);
+        if (w.first == w.second)
+            break;
+        const char* p = w.first;
+        while (p != w.second && !std::isspace((unsigned char) *p))
+            ++p;
+        if (p == w.second && w.second - w.first == window) {
+            window *= 2;  // Token longer than the window.
+            continue;
+        }
+        result.append(w.first, p);
+        if (p != w.second) {
+            result += '|';
+            ++p;
+        }
+        in.consume(p - w.first);
+    }
+    return result;
+}
+
+string tokenize_expected(const string& data)
+{
+    string result(data);
+    for (string::size_type z = 0; z < result.size(); ++z)
+        if (std::isspace((unsigned char) result[z]))
+            result[z] = '|';
+    return result;
+}
+
+void stream_peek_window_test()
+{
+    const string data = peek_test_data();
+    const string expected = tokenize_expected(data);
+
+    // Indirect stream buffer, refilled and enlarged as needed
+    {
+        stream<trickle_source> in(trickle_source(data), 16);
+        BOOST_CHECK(tokenize(in, 1) == expected);
+    }
+    {
+        stream<trickle_source> in(trickle_source(data), 16);
+        window_type w = in.peek_window(100);
+        BOOST_CHECK_EQUAL(w.second - w.first, 100);
+        BOOST_CHECK(string(w.first, w.second) == data.substr(0, 100));
+        in.consume(90);
+        w = in.peek_window(1000);
+        BOOST_CHECK_EQUAL(w.second - w.first, 1000);
+        BOOST_CHECK(string(w.first, w.second) == data.substr(90, 1000));
+        in.consume(10);
+
+        // Interleaved with ordinary input, including putback
+        BOOST_CHECK(in.get() == data[100]);
+        BOOST_CHECK(in.unget());
+        string buf(50, ' ');
+        in.read(&buf[0], 50);
+        BOOST_CHECK(buf == data.substr(100, 50));
+        w = in.peek_window(1);
+        BOOST_CHECK(w.first != w.second && *w.first == data[150]);
+
+        // Fewer characters are returned only at the end of the stream
+        w = in.peek_window(static_cast<std::streamsize>(data.size()));
+        BOOST_CHECK(string(w.first, w.second) == data.substr(150));
+        in.consume(w.second - w.first);
+        w = in.peek_window(1);
+        BOOST_CHECK(w.first == w.second);
+        BOOST_CHECK(in.get() == EOF);
+    }
+
+    // Direct stream buffer
+    {
+        stream<array_source> in(data.data(), data.size());
+        window_type w = in.peek_window(10);
+        BOOST_CHECK_EQUAL( w.second - w.first,
+                           static_cast<std::streamsize>(data.size()) );
+        BOOST_CHECK(tokenize(in, 1) == expected);
+    }
+
+    // Seekable device
+    {
+        temp_file temp;
+        {
+            stream<file> out(file(temp.name(), out_mode | BOOST_IOS::trunc));
+            out << data;
+        }
+        stream<file> in(file(temp.name(), in_mode), 16);
+        window_type w = in.peek_window(40);
+        BOOST_CHECK(string(w.first, w.second) == data.substr(0, 40));
+        in.consume(25);
+        BOOST_CHECK(in.tellg() == std::streampos(25));
+        in.seekg(200, BOOST_IOS::beg);
+        w = in.peek_window(40);
+        BOOST_CHECK(string(w.first, w.second) == data.substr(200, 40));
+    }
+}
+
+void filtering_peek_window_test()
+{
+    const string data = peek_test_data();
+    string upper(data);
+    for (string::size_type z = 0; z < upper.size(); ++z)
+        upper[z] = static_cast<char>(std::toupper((unsigned char) upper[z]));
+    const string expected = tokenize_expected(upper);
+
+    {
+        filtering_istream in;
+        in.push(toupper_filter(), 16);
+        in.push(trickle_source(data), 16);
+        BOOST_CHECK(tokenize(in, 1) == expected);
+    }
+
+    {
+        filtering_istreambuf in;
+        in.push(toupper_multichar_filter(), 16);
+        in.push(trickle_source(data), 16);
+        window_type w = in.peek_window(3);
+        BOOST_CHECK(string(w.first, w.first + 3) == upper.substr(0, 3));
+        in.consume(3);
+        BOOST_CHECK(in.sgetc() == upper[3]);
+        BOOST_CHECK(tokenize(in, 1) == expected.substr(3));
+    }
+
+    {
+        filtering_istream in;
+        BOOST_CHECK_THROW(in.peek_window(1), std::logic_error);
+    }
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("peek_window test");
+    test->add(BOOST_TEST_CASE(&stream_peek_window_test));
+    test->add(BOOST_TEST_CASE(&filtering_peek_window_test));
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
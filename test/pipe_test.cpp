@@ -0,0 +1,196 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/detail/adapter/non_blocking_adapter.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/pipe.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/read.hpp>
+#include <boost/iostreams/write.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/verification.hpp"
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Returns the test data repeated data_reps times.
+string test_string()
+{
+    string result;
+    for (int z = 0; z < data_reps; ++z)
+        result.append(narrow_data(), data_length());
+    return result;
+}
+
+void blocking_test()
+{
+    string data = test_string();
+
+    // Through streams, with a ring smaller than the data and the buffers
+    for (int z = 0; z < 2; ++z) {
+        pair<pipe_sink, pipe_source>  p = make_pipe(z ? 16 : 4096);
+        filtering_ostream             out(p.first);
+        string                        result;
+        std::thread                   reader([&] {
+            filtering_istream in(p.second);
+            io::copy(in, io::back_inserter(result));
+        });
+        write_data_in_chunks(out);
+        out.reset();
+        reader.join();
+        BOOST_CHECK(result == data);
+    }
+
+    // Single characters, through unbuffered streams
+    {
+        pair<pipe_sink, pipe_source>  p = make_pipe(8);
+        filtering_ostream             out(p.first, 0);
+        string                        result;
+        std::thread                   reader([&] {
+            filtering_istream in(p.second, 0);
+            io::copy(in, io::back_inserter(result));
+        });
+        write_data_in_chars(out);
+        out.reset();
+        reader.join();
+        BOOST_CHECK(result == data);
+    }
+
+    // Wide characters
+    {
+        pair<wpipe_sink, wpipe_source>  p = make_wpipe(4);
+        wstring                         result;
+        std::thread                     reader([&] {
+            wchar_t buf[3];
+            streamsize amt;
+            while ((amt = p.second.read(buf, 3)) != -1)
+                result.append(buf, static_cast<size_t>(amt));
+        });
+        BOOST_CHECK_EQUAL(p.first.write(L"wide characters", 15), 15);
+        p.first.close();
+        reader.join();
+        BOOST_CHECK(result == L"wide characters");
+    }
+
+    // A capacity which cannot be rounded up to a power of two is rejected
+    BOOST_CHECK_THROW(make_pipe(static_cast<size_t>(-1)), std::length_error);
+}
+
+void non_blocking_test()
+{
+    pair<pipe_sink, pipe_source>  p = make_pipe(8, pipe_non_blocking);
+    char                          buf[16];
+    BOOST_CHECK_EQUAL(p.first.capacity(), 8u);
+
+    // Writes stop when the ring is full and reads when it is empty
+    BOOST_CHECK_EQUAL(p.second.read(buf, 16), 0);
+    BOOST_CHECK_EQUAL(p.first.write("0123456789", 10), 8);
+    BOOST_CHECK_EQUAL(p.first.write("89", 2), 0);
+    BOOST_CHECK_EQUAL(p.second.read(buf, 3), 3);
+    BOOST_CHECK_EQUAL(string(buf, 3), "012");
+    BOOST_CHECK_EQUAL(p.first.write("89", 2), 2);
+    BOOST_CHECK_EQUAL(p.second.read(buf, 16), 7);
+    BOOST_CHECK_EQUAL(string(buf, 7), "3456789");
+    BOOST_CHECK_EQUAL(p.second.read(buf, 16), 0);
+
+    // Temporary failures are reported as by other non-blocking Devices
+    BOOST_CHECK_EQUAL(io::write(p.first, "abc", 3), 3);
+    BOOST_CHECK_EQUAL(io::read(p.second, buf, 16), 3);
+    BOOST_CHECK_EQUAL(io::read(p.second, buf, 16), 0);
+
+    // The end of the stream follows the characters written before closing
+    p.first.write("xy", 2);
+    p.first.close();
+    BOOST_CHECK_EQUAL(p.second.read(buf, 16), 2);
+    BOOST_CHECK_EQUAL(p.second.read(buf, 16), -1);
+}
+
+void non_blocking_adapter_test()
+{
+    string                        data = test_string();
+    pair<pipe_sink, pipe_source>  p = make_pipe(64, pipe_non_blocking);
+    std::thread                   writer([&] {
+        non_blocking_adapter<pipe_sink> out(p.first);
+        io::write(out, data.data(), static_cast<streamsize>(data.size()));
+        p.first.close();
+    });
+    non_blocking_adapter<pipe_source>  in(p.second);
+    string                             result(data.size() + 1, '?');
+    streamsize amt =
+        io::read(in, &result[0], static_cast<streamsize>(result.size()));
+    writer.join();
+    BOOST_CHECK_EQUAL(amt, static_cast<streamsize>(data.size()));
+    result.resize(data.size());
+    BOOST_CHECK(result == data);
+}
+
+void close_test()
+{
+    // Destroying the last copy of the sink closes it
+    {
+        pair<pipe_sink, pipe_source>  p = make_pipe(16);
+        pipe_source                   in = p.second;
+        p.first.write("ab", 2);
+        p = make_pipe();
+        char buf[4];
+        BOOST_CHECK_EQUAL(in.read(buf, 4), 2);
+        BOOST_CHECK_EQUAL(in.read(buf, 4), -1);
+    }
+
+    // A reader blocked on an empty ring wakes when the writer closes
+    {
+        pair<pipe_sink, pipe_source>  p = make_pipe(16);
+        streamsize                    amt = 0;
+        std::thread                   reader([&] {
+            char c;
+            amt = p.second.read(&c, 1);
+        });
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        p.first.close();
+        reader.join();
+        BOOST_CHECK_EQUAL(amt, -1);
+    }
+
+    // A writer blocked on a full ring fails when the reader closes
+    {
+        pair<pipe_sink, pipe_source>  p = make_pipe(16);
+        bool                          failed = false;
+        std::thread                   writer([&] {
+            string data(100, 'x');
+            try {
+                p.first.write(data.data(), static_cast<streamsize>(data.size()));
+            } catch (BOOST_IOSTREAMS_FAILURE&) {
+                failed = true;
+            }
+        });
+        char buf[4];
+        BOOST_CHECK_EQUAL(p.second.read(buf, 4), 4);
+        p.second.close();
+        writer.join();
+        BOOST_CHECK(failed);
+        BOOST_CHECK_THROW(p.first.write("a", 1), BOOST_IOSTREAMS_FAILURE);
+    }
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("pipe test");
+    test->add(BOOST_TEST_CASE(&blocking_test));
+    test->add(BOOST_TEST_CASE(&non_blocking_test));
+    test->add(BOOST_TEST_CASE(&non_blocking_adapter_test));
+    test->add(BOOST_TEST_CASE(&close_test));
+    return test;
+}
@@ -0,0 +1,195 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <atomic>
+#include <chrono>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <utility>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/prefetch_source.hpp>
+#include <boost/shared_ptr.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/closable.hpp"
+#include "detail/filters.hpp"
+#include "detail/operation_sequence.hpp"
+#include "detail/temp_file.hpp"
+#include "detail/verification.hpp"
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Source which reads from a string, counting the calls to read() and
+// throwing once a given number of characters have been read
+class counting_source : public source {
+public:
+    counting_source(const string& data, std::streamsize limit = -1)
+        : data_(data), pos_(0), limit_(limit),
+          reads_(new std::atomic<int>(0))
+        { }
+    std::streamsize read(char* s, std::streamsize n)
+    {
+        ++*reads_;
+        if (pos_ == data_.size())
+            return -1;
+        if (limit_ >= 0 && static_cast<std::streamsize>(pos_) >= limit_)
+            throw std::runtime_error("counting_source");
+        std::streamsize amt =
+            (std::min)(n, static_cast<std::streamsize>(data_.size() - pos_));
+        data_.copy(s, static_cast<string::size_type>(amt), pos_);
+        pos_ += static_cast<string::size_type>(amt);
+        return amt;
+    }
+    int reads() const { return reads_->load(); }
+private:
+    string                                   data_;
+    string::size_type                        pos_;
+    std::streamsize                          limit_;
+    boost::shared_ptr< std::atomic<int> >    reads_;
+};
+
+string make_data(int count)
+{
+    string result;
+    for (int z = 0; z < count; ++z)
+        result += static_cast<char>('a' + z % 26);
+    return result;
+}
+
+void read_prefetch_source_test()
+{
+    test_file test;
+
+    {
+        filtering_istream first, second;
+        first.push(prefetch_source<file_source>(
+            file_source(test.name(), in_mode), 3, 100 ));
+        second.push(file_source(test.name(), in_mode));
+        BOOST_CHECK_MESSAGE(
+            compare_streams_in_chars(first, second),
+            "failed reading from prefetch_source in chars"
+        );
+    }
+
+    {
+        filtering_istream first, second;
+        first.push(toupper_filter());
+        first.push(prefetch_source<file_source>(
+            file_source(test.name(), in_mode), 2, 7 ));
+        second.push(toupper_filter());
+        second.push(file_source(test.name(), in_mode));
+        BOOST_CHECK_MESSAGE(
+            compare_streams_in_chunks(first, second),
+            "failed reading from prefetch_source in chunks"
+        );
+    }
+}
+
+void peek_window_test()
+{
+    typedef std::pair<const char*, const char*> window_type;
+    string data = make_data(1000);
+
+    // Buffers are handed over in order, without copying
+    prefetch_source<counting_source> src(counting_source(data), 2, 64);
+    string result;
+    for (;;) {
+        window_type w = src.peek_window();
+        if (w.first == w.second)
+            break;
+        BOOST_CHECK(w.second - w.first <= 64);
+        std::streamsize n = (std::min)(w.second - w.first, std::ptrdiff_t(10));
+        result.append(w.first, static_cast<string::size_type>(n));
+        src.consume(n);
+    }
+    BOOST_CHECK(result == data);
+    char c;
+    BOOST_CHECK_EQUAL(src.read(&c, 0), 0);
+    BOOST_CHECK_EQUAL(src.read(&c, 1), -1);
+
+    // A request for no characters is not mistaken for the end of the
+    // sequence
+    prefetch_source<counting_source> other(counting_source(data), 2, 64);
+    BOOST_CHECK_EQUAL(other.read(&c, 0), 0);
+    BOOST_CHECK_EQUAL(other.read(&c, 1), 1);
+    BOOST_CHECK_EQUAL(c, data[0]);
+}
+
+void read_ahead_test()
+{
+    // The background thread fills depth buffers, and no more
+    string                          data = make_data(1000);
+    counting_source                 counter(data);
+    prefetch_source<counting_source> src(counter, 3, 10);
+    char buf[5];
+    BOOST_CHECK_EQUAL(src.read(buf, 5), 5);
+    for (int z = 0; z < 1000 && counter.reads() < 3; ++z)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    BOOST_CHECK_EQUAL(counter.reads(), 3);
+
+    // Releasing a buffer lets the background thread read another
+    BOOST_CHECK_EQUAL(src.read(buf, 5), 5);
+    BOOST_CHECK_EQUAL(src.read(buf, 1), 1);
+    for (int z = 0; z < 1000 && counter.reads() < 4; ++z)
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    BOOST_CHECK_EQUAL(counter.reads(), 4);
+    src.close();
+}
+
+void error_test()
+{
+    // Characters read before an exception are delivered first
+    string                          data = make_data(100);
+    prefetch_source<counting_source> src(counting_source(data, 30), 4, 10);
+    string result;
+    char buf[7];
+    try {
+        for (;;) {
+            std::streamsize n = src.read(buf, sizeof(buf));
+            if (n == -1)
+                break;
+            result.append(buf, static_cast<string::size_type>(n));
+        }
+        BOOST_ERROR("failed propagating exception from prefetch_source");
+    } catch (const std::runtime_error&) { }
+    BOOST_CHECK(result == data.substr(0, 30));
+}
+
+void close_test()
+{
+    operation_sequence seq;
+    {
+        filtering_istream in;
+        in.push(prefetch_source< closable_device<input> >(
+            closable_device<input>(seq.new_operation(1)) ));
+        BOOST_CHECK(in.get() == EOF);
+        BOOST_CHECK_NO_THROW(in.reset());
+    }
+    BOOST_CHECK_OPERATION_SEQUENCE(seq);
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("prefetch_source test");
+    test->add(BOOST_TEST_CASE(&read_prefetch_source_test));
+    test->add(BOOST_TEST_CASE(&peek_window_test));
+    test->add(BOOST_TEST_CASE(&read_ahead_test));
+    test->add(BOOST_TEST_CASE(&error_test));
+    test->add(BOOST_TEST_CASE(&close_test));
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
@@ -0,0 +1,225 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <list>
+#include <string>
+#include <vector>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/detail/adapter/output_iterator_adapter.hpp>
+#include <boost/iostreams/detail/adapter/range_adapter.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/traits.hpp>
+#include <boost/range/iterator_range.hpp>
+#include <boost/static_assert.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/sequence.hpp"
+#include "detail/verification.hpp"
+
+using namespace std;
+using boost::iterator_range;
+using boost::make_iterator_range;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+template<typename Mode, typename Iter>
+struct range_device {
+    typedef io::detail::range_adapter< Mode, iterator_range<Iter> > type;
+};
+
+void category_test()
+{
+    typedef vector<char>::iterator        vec_iter;
+    typedef vector<char>::const_iterator  vec_citer;
+    typedef string::iterator              str_iter;
+    typedef list<char>::iterator          list_iter;
+
+    BOOST_STATIC_ASSERT(
+        (is_direct<range_device<input, char*>::type>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (is_direct<range_device<input, vec_iter>::type>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (is_direct<range_device<input, vec_citer>::type>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (is_direct<range_device<output, vec_iter>::type>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (is_direct<range_device<output, str_iter>::type>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (is_direct<range_device<seekable, vec_iter>::type>::value)
+    );
+
+    // Non-contiguous iterators, read-only elements and two-sequence modes
+    BOOST_STATIC_ASSERT(
+        (!is_direct<range_device<input, list_iter>::type>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (!is_direct<range_device<output, vec_citer>::type>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (!is_direct<range_device<bidirectional, vec_iter>::type>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (!is_direct<range_device<dual_seekable, vec_iter>::type>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (!io::detail::is_contiguous_iterator<vector<bool>::iterator>::value)
+    );
+    BOOST_STATIC_ASSERT(
+        (!io::detail::is_contiguous_iterator<
+             std::back_insert_iterator<string>
+         >::value)
+    );
+}
+
+void read_write_test()
+{
+    vector<char>  src(data_reps * data_length());
+    for (size_t z = 0; z < src.size(); ++z)
+        src[z] = narrow_data()[z % data_length()];
+
+    // Member functions read() and write(), which use memcpy
+    {
+        range_device<input, vector<char>::iterator>::type
+                      in(make_iterator_range(src));
+        vector<char>  dest;
+        char          buf[97];
+        for (std::streamsize amt; (amt = in.read(buf, 97)) != -1; )
+            dest.insert(dest.end(), buf, buf + amt);
+        BOOST_CHECK(dest == src);
+
+        vector<char>  out(10);
+        range_device<output, vector<char>::iterator>::type
+                      sink(make_iterator_range(out));
+        BOOST_CHECK_EQUAL(sink.write(&src[0], 4), 4);
+        BOOST_CHECK_THROW(
+            sink.write(&src[0] + 4, 7), BOOST_IOSTREAMS_FAILURE
+        );
+        BOOST_CHECK(equal(out.begin(), out.end(), src.begin()));
+    }
+
+    // Streams, which use the ranges directly
+    {
+        vector<char>       dest(src.size(), '?');
+        filtering_ostream  out(make_iterator_range(dest));
+        out.write(&src[0], static_cast<std::streamsize>(src.size()));
+        out.flush();
+        BOOST_CHECK(dest == src);
+
+        filtering_istream  in(make_iterator_range(src));
+        vector<char>       back(src.size() + 1, '?');
+        in.read(&back[0], static_cast<std::streamsize>(back.size()));
+        BOOST_CHECK_EQUAL(
+            in.gcount(), static_cast<std::streamsize>(src.size())
+        );
+        back.pop_back();
+        BOOST_CHECK(back == src);
+    }
+
+    // An empty range
+    {
+        vector<char>       empty;
+        filtering_istream  in(make_iterator_range(empty));
+        BOOST_CHECK(in.get() == EOF);
+        BOOST_CHECK(in.eof());
+    }
+}
+
+void seek_test()
+{
+    string                      text("abcdefghij");
+    filtering_stream<seekable>  str(make_iterator_range(text));
+    str.seekp(3);
+    str.put('X');
+    BOOST_CHECK_EQUAL(text, "abcXefghij");
+    str.seekg(-2, BOOST_IOS::end);
+    BOOST_CHECK_EQUAL(str.get(), 'i');
+    str.seekg(0);
+    string result;
+    getline(str, result);
+    BOOST_CHECK_EQUAL(result, "abcXefghij");
+}
+
+void copy_test()
+{
+    string  src("copy between contiguous ranges");
+
+    // Direct source and direct sink
+    {
+        vector<char> dest(src.size(), '?');
+        BOOST_CHECK_EQUAL(
+            io::copy(make_iterator_range(src), make_iterator_range(dest)),
+            static_cast<std::streamsize>(src.size())
+        );
+        BOOST_CHECK(string(dest.begin(), dest.end()) == src);
+    }
+
+    // A direct sink is filled without overflowing
+    {
+        vector<char> dest(4, '?');
+        array_source in(src.data(), src.size());
+        BOOST_CHECK_EQUAL(io::copy(in, make_iterator_range(dest)), 4);
+        BOOST_CHECK(string(dest.begin(), dest.end()) == "copy");
+    }
+
+    // Direct source and indirect sink
+    {
+        string dest;
+        io::copy(make_iterator_range(src), io::back_inserter(dest));
+        BOOST_CHECK_EQUAL(dest, src);
+    }
+}
+
+void output_iterator_test()
+{
+    // Contiguous output iterators advance past the characters written
+    {
+        char buf[8] = "-------";
+        io::detail::output_iterator_adapter<output, char, char*> out(buf);
+        out.write("abc", 3);
+        out.write("de", 2);
+        BOOST_CHECK_EQUAL(string(buf), "abcde--");
+    }
+
+    // So do other forward iterators
+    {
+        list<char> lst(5, '-');
+        io::detail::output_iterator_adapter<
+            output, char, list<char>::iterator
+        > out(lst.begin());
+        out.write("ab", 2);
+        out.write("c", 1);
+        BOOST_CHECK_EQUAL(string(lst.begin(), lst.end()), "abc--");
+    }
+
+    // Through a stream
+    {
+        vector<char>       dest(5, '-');
+        filtering_ostream  out(&dest[0], 0);
+        out << "xyz" << flush;
+        out << "w" << flush;
+        BOOST_CHECK_EQUAL(string(dest.begin(), dest.end()), "xyzw-");
+    }
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("range_adapter test");
+    test->add(BOOST_TEST_CASE(&category_test));
+    test->add(BOOST_TEST_CASE(&read_write_test));
+    test->add(BOOST_TEST_CASE(&seek_test));
+    test->add(BOOST_TEST_CASE(&copy_test));
+    test->add(BOOST_TEST_CASE(&output_iterator_test));
+    return test;
+}
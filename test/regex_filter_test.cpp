@@ -6,9 +6,11 @@
 // See http://www.boost.org/libs/iostreams for documentation.
 
 #include <fstream>
+#include <stdexcept>
 #include <boost/iostreams/device/file.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 #include <boost/iostreams/filter/regex.hpp>
+#include <boost/iostreams/filter/test.hpp>
 #include <boost/test/test_tools.hpp>
 #include <boost/test/unit_test.hpp>
 #include "detail/temp_file.hpp"
@@ -171,6 +173,56 @@ void regex_filter_test()
     }
 }
 
+void streaming_regex_filter_test()
+{
+    // Compare the output of streaming_regex_filter with regex_replace,
+    // using a window much smaller than the input, for expressions involving
+    // empty matches, anchors and lookbehind.
+    const char* exprs[] = 
+        { "[a-z]+", "x*", "\\bcat\\b", "^d[a-z]*", "(?<=o)g", "t$" };
+    const char* fmts[] = 
+        { "<$&>", "-", "CAT", "[$&]", "G", "T" };
+    std::string input;
+    unsigned int seed = 1;
+    const char* words[] = { "cat", "dog", "xx", "concat", "t" };
+    for (int z = 0; z < 600; ++z) {
+        seed = seed * 1103515245 + 12345;
+        input += words[(seed >> 16) % 5];
+        input += (seed >> 20) % 4 ? ' ' : '\n';
+    }
+    for (int z = 0; z < 6; ++z) {
+        boost::regex re(exprs[z]);
+        std::string  output = boost::regex_replace(input, re, fmts[z]);
+        BOOST_CHECK_MESSAGE(
+            test_input_filter(streaming_regex_filter(re, fmts[z], 16), 
+                              input, output),
+            "failed reading from streaming_regex_filter"
+        );
+        BOOST_CHECK_MESSAGE(
+            test_output_filter(streaming_regex_filter(re, fmts[z], 16), 
+                               input, output),
+            "failed writing to streaming_regex_filter"
+        );
+    }
+    BOOST_CHECK_MESSAGE(
+        test_input_filter( 
+            streaming_regex_filter(boost::regex("[a-z]+"), replace_lower()), 
+            input, boost::regex_replace(input, boost::regex("[a-z]+"), 
+                                        "ABCDEFGHIJKLMNOPQRSTUVWXYZ") ),
+        "failed reading from function-based streaming_regex_filter"
+    );
+
+    // A window which is not positive is rejected
+    BOOST_CHECK_THROW(
+        streaming_regex_filter(boost::regex("a"), "b", 0),
+        std::invalid_argument
+    );
+    BOOST_CHECK_THROW(
+        streaming_regex_filter(boost::regex("a"), "b", -1),
+        std::invalid_argument
+    );
+}
+
 #if !defined(BOOST_IOSTREAMS_NO_WIDE_STREAMS) && !defined(BOOST_NO_WREGEX)
 
 void wregex_filter_test()
@@ -322,6 +374,7 @@ test_suite* init_unit_test_suite(int, char* [])
 {
     test_suite* test = BOOST_TEST_SUITE("regex_filter test");
     test->add(BOOST_TEST_CASE(&regex_filter_test));
+    test->add(BOOST_TEST_CASE(&streaming_regex_filter_test));
 #if !defined(BOOST_IOSTREAMS_NO_WIDE_STREAMS) && !defined(BOOST_NO_WREGEX)
     test->add(BOOST_TEST_CASE(&wregex_filter_test));
 #endif
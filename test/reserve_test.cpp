@@ -0,0 +1,167 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <cctype>
+#include <cstring>
+#include <string>
+#include <utility>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/filters.hpp"
+#include "detail/temp_file.hpp"
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+typedef std::pair<char*, char*> span_type;
+
+// Writes records of increasing length directly into the stream buffer,
+// returning the concatenated records
+template<typename Stream>
+string encode_records(Stream& out, int count)
+{
+    string expected;
+    for (int z = 0; z < count; ++z) {
+        string record(static_cast<string::size_type>(z % 50 + 1), 'a');
+        for (string::size_type i = 0; i < record.size(); ++i)
+            record[i] = static_cast<char>('A' + (z + i) % 26);
+        std::streamsize size = static_cast<std::streamsize>(record.size());
+        span_type s = out.reserve(size);
+        BOOST_REQUIRE(s.second - s.first >= size);
+        std::memcpy(s.first, record.data(), record.size());
+        out.commit(size);
+        expected += record;
+    }
+    return expected;
+}
+
+string lowercase(string s)
+{
+    for (string::size_type z = 0; z < s.size(); ++z)
+        s[z] = static_cast<char>(std::tolower((unsigned char) s[z]));
+    return s;
+}
+
+void stream_reserve_test()
+{
+    // Indirect stream buffer
+    {
+        string                             dest;
+        stream< back_insert_device<string> > out(io::back_inserter(dest), 16);
+        string expected = encode_records(out, 200);
+        out.flush();
+        BOOST_CHECK(dest == expected);
+    }
+
+    // Interleaved with ordinary output
+    {
+        string                             dest;
+        stream< back_insert_device<string> > out(io::back_inserter(dest), 16);
+        out << "head:";
+        span_type s = out.reserve(3);
+        std::memcpy(s.first, "abc", 3);
+        out.commit(3);
+        out << ":tail";
+        s = out.reserve(40);  // Larger than the buffer
+        BOOST_CHECK(s.second - s.first >= 40);
+        std::memset(s.first, 'x', 40);
+        out.commit(40);
+        out.flush();
+        BOOST_CHECK(dest == "head:abc:tail" + string(40, 'x'));
+    }
+
+    // Unbuffered stream
+    {
+        string                             dest;
+        stream< back_insert_device<string> > out(io::back_inserter(dest), 0);
+        string expected = encode_records(out, 20);
+        out << "end";
+        out.flush();
+        BOOST_CHECK(dest == expected + "end");
+    }
+
+    // Direct stream buffer
+    {
+        char                 buf[100];
+        stream<array_sink>   out(buf, sizeof(buf));
+        span_type s = out.reserve(10);
+        BOOST_CHECK(s.first == buf && s.second == buf + sizeof(buf));
+        std::memcpy(s.first, "0123456789", 10);
+        out.commit(10);
+        out << "abc";
+        BOOST_CHECK(std::string(buf, 13) == "0123456789abc");
+    }
+
+    // Seekable device, alternating input and output
+    {
+        temp_file     temp;
+        stream<file>  io( file(temp.name(), in_mode | out_mode | BOOST_IOS::trunc),
+                          16 );
+        string expected = encode_records(io, 30);
+        io.seekg(0, BOOST_IOS::beg);
+        string result(expected.size(), ' ');
+        io.read(&result[0], 10);
+        span_type s = io.reserve(5);
+        std::memcpy(s.first, "-----", 5);
+        io.commit(5);
+        io.seekg(0, BOOST_IOS::beg);
+        io.read(&result[0], static_cast<std::streamsize>(result.size()));
+        expected.replace(10, 5, "-----");
+        BOOST_CHECK(result == expected);
+    }
+}
+
+void filtering_reserve_test()
+{
+    {
+        string            dest;
+        filtering_ostream out;
+        out.push(tolower_filter(), 16);
+        out.push(io::back_inserter(dest), 16);
+        string expected = encode_records(out, 200);
+        out.flush();
+        BOOST_CHECK(dest == lowercase(expected));
+    }
+
+    {
+        string               dest;
+        filtering_ostreambuf out;
+        out.push(tolower_multichar_filter(), 16);
+        out.push(io::back_inserter(dest), 16);
+        string expected = encode_records(out, 200);
+        out.sputn("END", 3);
+        out.pubsync();
+        expected += "END";
+        BOOST_CHECK(dest == lowercase(expected));
+    }
+
+    {
+        filtering_ostream out;
+        BOOST_CHECK_THROW(out.reserve(1), std::logic_error);
+    }
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("reserve test");
+    test->add(BOOST_TEST_CASE(&stream_reserve_test));
+    test->add(BOOST_TEST_CASE(&filtering_reserve_test));
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
@@ -0,0 +1,247 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <cstddef>
+#include <string>
+#include <boost/iostreams/buffer_pool.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/operations.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/closable.hpp"
+#include "detail/filters.hpp"
+#include "detail/operation_sequence.hpp"
+#include "detail/temp_file.hpp"
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Output filter which appends to each sequence written to it the number of
+// characters in the sequence; close() resets the count
+class counting_filter : public output_filter {
+public:
+    counting_filter() : count_(0) { }
+    template<typename Sink>
+    bool put(Sink& snk, char c)
+    {
+        ++count_;
+        return io::put(snk, c);
+    }
+    template<typename Sink>
+    void close(Sink& snk)
+    {
+        string count;
+        do {
+            count.insert(count.begin(), static_cast<char>('0' + count_ % 10));
+            count_ /= 10;
+        } while (count_ != 0);
+        io::put(snk, '#');
+        io::write(snk, count.data(), static_cast<std::streamsize>(count.size()));
+    }
+private:
+    int count_;
+};
+
+// Pool which forwards to buffer_pool, counting requests
+struct counting_pool {
+    static void* allocate(std::size_t size)
+    {
+        ++allocations;
+        return buffer_pool::allocate(size);
+    }
+    static void deallocate(void* p, std::size_t size)
+    { buffer_pool::deallocate(p, size); }
+    static int allocations;
+};
+
+int counting_pool::allocations = 0;
+
+typedef filtering_stream<
+            output, char, std::char_traits<char>,
+            pooled_allocator<char, counting_pool>
+        >                                             counting_ostream;
+
+void rewind_output_test()
+{
+    {
+        string               dest;
+        filtering_ostream    out;
+        out.push(counting_filter());
+        out.push(tolower_filter(), 4);
+        out.push(io::back_inserter(dest));
+        counting_filter* f = out.component<counting_filter>(0);
+        out << "ABC";
+        out.rewind();
+        BOOST_CHECK(dest == "abc#3");
+        BOOST_CHECK(out.is_complete());
+        BOOST_CHECK(out.component<counting_filter>(0) == f);
+        out << "DEFGH";
+        out.rewind();
+        BOOST_CHECK(dest == "abc#3defgh#5");
+        out << "I";
+        out.reset();
+        BOOST_CHECK(dest == "abc#3defgh#5i#1");
+    }
+
+    // Components are closed in the usual order
+    {
+        operation_sequence  seq;
+        filtering_ostream   out;
+        out.push(closable_filter<output>(seq.new_operation(1)));
+        out.push(closable_device<output>(seq.new_operation(2)));
+        out << "x";
+        BOOST_CHECK_NO_THROW(out.rewind());
+        BOOST_CHECK_OPERATION_SEQUENCE(seq);
+    }
+
+    // Stream buffers
+    {
+        string               dest;
+        filtering_ostreambuf out;
+        out.push(counting_filter());
+        out.push(io::back_inserter(dest));
+        out.sputn("ab", 2);
+        out.rewind();
+        out.sputn("cde", 3);
+        out.rewind();
+        BOOST_CHECK(dest == "ab#2cde#3");
+    }
+}
+
+void reopen_output_test()
+{
+    // A device of the same type reuses the link and its buffers
+    {
+        string            dest1, dest2, dest3;
+        counting_ostream  out;
+        out.push(counting_filter());
+        out.push(tolower_multichar_filter(), 16);
+        out.push(io::back_inserter(dest1), 16);
+        out << "Request One";
+        int allocations = counting_pool::allocations;
+        for (int z = 0; z < 10; ++z) {
+            out.reopen(io::back_inserter(dest2));
+            out << "Request Two";
+        }
+        BOOST_CHECK_EQUAL(counting_pool::allocations, allocations);
+        out.reopen(io::back_inserter(dest3));
+        BOOST_CHECK(dest1 == "request one#11");
+        BOOST_CHECK(dest3.empty());
+        out << "Request Three";
+        out.reset();
+        BOOST_CHECK(dest3 == "request three#13");
+    }
+
+    // A device of a different type replaces the final link
+    {
+        temp_file          temp;
+        string             dest;
+        filtering_ostream  out;
+        out.push(counting_filter());
+        out.push(io::back_inserter(dest));
+        out << "abc";
+        out.reopen(file_sink(temp.name(), out_mode));
+        BOOST_CHECK_EQUAL(out.size(), 2u);
+        out << "defg";
+        out.reopen(io::back_inserter(dest));
+        BOOST_CHECK(dest == "abc#3");
+        out.reset();
+        BOOST_CHECK(dest == "abc#3#0");
+
+        filtering_istream in;
+        in.push(file_source(temp.name(), in_mode));
+        string contents;
+        std::getline(in, contents);
+        BOOST_CHECK(contents == "defg#4");
+    }
+
+    // An incomplete chain is completed
+    {
+        string               dest;
+        filtering_ostreambuf out;
+        out.push(counting_filter());
+        out.reopen(io::back_inserter(dest));
+        BOOST_CHECK(out.is_complete());
+        out.sputn("xy", 2);
+        out.reset();
+        BOOST_CHECK(dest == "xy#2");
+    }
+}
+
+void reopen_input_test()
+{
+    const char     data1[] = "first sequence";
+    const char     data2[] = "second";
+    string         result;
+
+    // Direct device
+    {
+        filtering_istream in;
+        in.push(toupper_filter(), 4);
+        in.push(array_source(data1, sizeof(data1) - 1));
+        std::getline(in, result);
+        BOOST_CHECK(result == "FIRST SEQUENCE");
+        BOOST_CHECK(in.eof());
+        in.reopen(array_source(data2, sizeof(data2) - 1));
+        BOOST_CHECK(in.good());
+        std::getline(in, result);
+        BOOST_CHECK(result == "SECOND");
+        in.rewind();
+        std::getline(in, result);
+        BOOST_CHECK(result == "SECOND");
+    }
+
+    // Indirect device, reopened after partial input
+    {
+        temp_file temp;
+        {
+            filtering_ostream out(file_sink(temp.name(), out_mode));
+            out << data2;
+        }
+        filtering_istream in;
+        in.push(toupper_multichar_filter(), 4);
+        in.push(file_source(temp.name(), in_mode), 4);
+        char c;
+        in.get(c);
+        BOOST_CHECK(c == 'S');
+        in.reopen(file_source(temp.name(), in_mode));
+        std::getline(in, result);
+        BOOST_CHECK(result == "SECOND");
+    }
+
+    // Stream buffers
+    {
+        filtering_istreambuf in;
+        in.push(toupper_filter());
+        in.push(array_source(data1, sizeof(data1) - 1));
+        BOOST_CHECK(in.sgetc() == 'F');
+        in.reopen(array_source(data2, sizeof(data2) - 1));
+        char buf[sizeof(data2)] = { 0 };
+        BOOST_CHECK_EQUAL(in.sgetn(buf, sizeof(buf)), std::streamsize(6));
+        BOOST_CHECK(string(buf) == "SECOND");
+    }
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("rewind test");
+    test->add(BOOST_TEST_CASE(&rewind_output_test));
+    test->add(BOOST_TEST_CASE(&reopen_output_test));
+    test->add(BOOST_TEST_CASE(&reopen_input_test));
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
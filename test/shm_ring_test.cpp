@@ -0,0 +1,226 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <cstring>
+#include <string>
+#include <thread>
+#include <utility>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/shm_ring.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/temp_file.hpp"
+#include "detail/verification.hpp"
+
+#ifdef BOOST_IOSTREAMS_POSIX
+# include <sys/wait.h>
+# include <unistd.h>
+#endif
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Returns the test data repeated data_reps times.
+string test_string()
+{
+    string result;
+    for (int z = 0; z < data_reps; ++z)
+        result.append(narrow_data(), data_length());
+    return result;
+}
+
+// Reads the ring at the given path to the end of the stream.
+string read_all(const string& path)
+{
+    string             result;
+    filtering_istream  in(shm_ring_source(path), 256);
+    io::copy(in, io::back_inserter(result));
+    return result;
+}
+
+void construction_test()
+{
+    temp_file path;
+    BOOST_CHECK_EQUAL(shm_ring_sink(path.name(), 1000).capacity(), 1024u);
+    BOOST_CHECK_EQUAL(shm_ring_sink(path.name(), 4096).capacity(), 4096u);
+    BOOST_CHECK_THROW(shm_ring_sink(path.name(), 0), BOOST_IOSTREAMS_FAILURE);
+
+    shm_ring_sink    out(path.name(), 64);
+    shm_ring_source  in(path.name());
+    BOOST_CHECK_EQUAL(in.capacity(), 64u);
+
+    // A file which does not hold a ring
+    test_file other;
+    BOOST_CHECK_THROW(shm_ring_source(other.name()), BOOST_IOSTREAMS_FAILURE);
+}
+
+void read_write_test()
+{
+    string data = test_string();
+
+    // Through streams, with a ring smaller than the data and the buffers
+    for (int z = 0; z < 2; ++z) {
+        temp_file          path;
+        filtering_ostream  out(shm_ring_sink(path.name(), z ? 64 : 4096));
+        string             result;
+        std::thread        reader([&] { result = read_all(path.name()); });
+        write_data_in_chunks(out);
+        out.reset();
+        reader.join();
+        BOOST_CHECK(result == data);
+    }
+
+    // Single characters
+    {
+        temp_file          path;
+        filtering_ostream  out(shm_ring_sink(path.name(), 16), 0);
+        string             result;
+        std::thread        reader([&] { result = read_all(path.name()); });
+        write_data_in_chars(out);
+        out.reset();
+        reader.join();
+        BOOST_CHECK(result == data);
+    }
+}
+
+void direct_test()
+{
+    temp_file        path;
+    shm_ring_sink    out(path.name(), 16);
+    shm_ring_source  in(path.name());
+
+    // The free space wraps around the end of the ring
+    pair<char*, char*> w = out.writable();
+    BOOST_CHECK_EQUAL(w.second - w.first, 16);
+    memcpy(w.first, "0123456789", 10);
+    out.commit(10);
+    pair<const char*, const char*> r = in.readable();
+    BOOST_CHECK_EQUAL(string(r.first, r.second), "0123456789");
+    in.consume(8);
+    w = out.writable();
+    BOOST_CHECK_EQUAL(w.second - w.first, 6);
+    memcpy(w.first, "abcdef", 6);
+    out.commit(6);
+    w = out.writable();
+    BOOST_CHECK_EQUAL(w.second - w.first, 8);
+    memcpy(w.first, "gh", 2);
+    out.commit(2);
+    r = in.readable();
+    BOOST_CHECK_EQUAL(string(r.first, r.second), "89abcdef");
+    in.consume(8);
+    r = in.readable();
+    BOOST_CHECK_EQUAL(string(r.first, r.second), "gh");
+    in.consume(2);
+
+    // An empty sequence marks the end of the stream
+    out.close();
+    r = in.readable();
+    BOOST_CHECK(r.first == r.second);
+    char c;
+    BOOST_CHECK_EQUAL(in.read(&c, 1), -1);
+}
+
+void close_test()
+{
+    // Data written before the writer closes is read before the end of stream
+    {
+        temp_file        path;
+        shm_ring_sink    out(path.name(), 64);
+        shm_ring_source  in(path.name());
+        out.write("hello", 5);
+        out.close();
+        char buf[16];
+        BOOST_CHECK_EQUAL(in.read(buf, 16), 5);
+        BOOST_CHECK_EQUAL(string(buf, 5), "hello");
+        BOOST_CHECK_EQUAL(in.read(buf, 16), -1);
+    }
+
+    // Destroying the last copy of the sink closes it
+    {
+        temp_file         path;
+        shm_ring_source*  in = 0;
+        {
+            shm_ring_sink out(path.name(), 64);
+            in = new shm_ring_source(path.name());
+            shm_ring_sink copy(out);
+            copy.write("ab", 2);
+        }
+        char buf[4];
+        BOOST_CHECK_EQUAL(in->read(buf, 4), 2);
+        BOOST_CHECK_EQUAL(in->read(buf, 4), -1);
+        delete in;
+    }
+
+    // A writer blocked on a full ring fails when the reader closes
+    {
+        temp_file        path;
+        shm_ring_sink    out(path.name(), 64);
+        shm_ring_source  in(path.name());
+        bool             failed = false;
+        std::thread      writer([&] {
+            string data(1000, 'x');
+            try {
+                out.write(data.data(), static_cast<streamsize>(data.size()));
+            } catch (BOOST_IOSTREAMS_FAILURE&) {
+                failed = true;
+            }
+        });
+        char buf[16];
+        BOOST_CHECK_EQUAL(in.read(buf, 16), 16);
+        in.close();
+        writer.join();
+        BOOST_CHECK(failed);
+    }
+}
+
+#ifdef BOOST_IOSTREAMS_POSIX
+
+void process_test()
+{
+    temp_file  path;
+    string     data;
+    for (int z = 0; z < 10; ++z)
+        data += test_string();
+    pid_t      pid;
+    {
+        filtering_ostream out(shm_ring_sink(path.name(), 4096));
+        pid = ::fork();
+        BOOST_REQUIRE(pid != -1);
+        if (pid == 0) {
+            int status = 1;
+            try {
+                status = read_all(path.name()) == data ? 0 : 2;
+            } catch (...) { }
+            ::_exit(status);
+        }
+        for (int z = 0; z < 10; ++z)
+            write_data_in_chunks(out);
+    }
+    int status = 0;
+    BOOST_REQUIRE(::waitpid(pid, &status, 0) == pid);
+    BOOST_CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+}
+
+#endif // #ifdef BOOST_IOSTREAMS_POSIX
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("shm_ring test");
+    test->add(BOOST_TEST_CASE(&construction_test));
+    test->add(BOOST_TEST_CASE(&read_write_test));
+    test->add(BOOST_TEST_CASE(&direct_test));
+    test->add(BOOST_TEST_CASE(&close_test));
+#ifdef BOOST_IOSTREAMS_POSIX
+    test->add(BOOST_TEST_CASE(&process_test));
+#endif
+    return test;
+}
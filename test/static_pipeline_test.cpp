@@ -0,0 +1,213 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <fstream>
+#include <string>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/static_pipeline.hpp>
+#include <boost/iostreams/stream.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/closable.hpp"
+#include "detail/operation_sequence.hpp"
+#include "detail/filters.hpp"
+#include "detail/temp_file.hpp"
+#include "detail/verification.hpp"
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Filter which replaces each character by the next, using putback() to
+// examine it
+struct lookahead_filter : public input_filter {
+    template<typename Source>
+    int get(Source& src)
+    {
+        int c = io::get(src);
+        if (c == EOF || c == WOULD_BLOCK)
+            return c;
+        int next = io::get(src);
+        if (next == WOULD_BLOCK)
+            return WOULD_BLOCK;
+        if (next != EOF)
+            BOOST_REQUIRE(io::putback(src, static_cast<char>(next)));
+        return next == EOF ? c : next;
+    }
+};
+BOOST_IOSTREAMS_PIPABLE(lookahead_filter, 0)
+
+void read_static_pipeline()
+{
+    test_file src;
+
+    // Single-character filters, accessing their sources through buffers
+    {
+        typedef static_pipeline<
+                    toupper_filter,
+                    static_pipeline<padding_filter, file_source>
+                > pipeline_type;
+        filtering_istream     first;
+        stream<pipeline_type> second(
+            make_static_pipeline( toupper_filter() |
+                                  padding_filter('a') |
+                                  file_source(src.name(), in_mode) )
+        );
+        first.push(toupper_filter());
+        first.push(padding_filter('a'));
+        first.push(file_source(src.name(), in_mode));
+        BOOST_CHECK_MESSAGE(
+            compare_streams_in_chunks(first, second),
+            "failed reading from a static_pipeline of single-character filters"
+        );
+    }
+
+    // Multi-character filters, accessing their sources directly
+    {
+        filtering_istream first;
+        stream<
+            static_pipeline<
+                toupper_multichar_filter,
+                static_pipeline<padding_filter, file_source>
+            >
+        > second(
+            make_static_pipeline( toupper_multichar_filter() |
+                                  padding_filter('a') |
+                                  file_source(src.name(), in_mode) )
+        );
+        first.push(toupper_multichar_filter());
+        first.push(padding_filter('a'));
+        first.push(file_source(src.name(), in_mode));
+        BOOST_CHECK_MESSAGE(
+            compare_streams_in_chunks(first, second),
+            "failed reading from a static_pipeline of multi-character filters"
+        );
+    }
+
+    // Putback across buffer boundaries
+    {
+        std::string  input(5000, 'x'), output;
+        for (std::string::size_type z = 0; z < input.size(); ++z)
+            input[z] = static_cast<char>('a' + z % 26);
+        io::copy(
+            make_static_pipeline( lookahead_filter() |
+                                  array_source(input.data(), input.size()) ),
+            io::back_inserter(output)
+        );
+        BOOST_CHECK(output == input.substr(1) + input.substr(input.size() - 1));
+    }
+}
+
+void write_static_pipeline()
+{
+    temp_file dest1, dest2, dest3;
+
+    {
+        filtering_ostream out1;
+        out1.push(tolower_filter());
+        out1.push(padding_filter('a'));
+        out1.push(file_sink(dest1.name(), out_mode));
+        write_data_in_chunks(out1);
+    }
+
+    {
+        stream<
+            static_pipeline<
+                tolower_filter,
+                static_pipeline<padding_filter, file_sink>
+            >
+        > out2(
+            make_static_pipeline( tolower_filter() |
+                                  padding_filter('a') |
+                                  file_sink(dest2.name(), out_mode) )
+        );
+        write_data_in_chunks(out2);
+    }
+
+    {
+        stream<
+            static_pipeline<
+                tolower_multichar_filter,
+                static_pipeline<padding_filter, file_sink>
+            >
+        > out3(
+            make_static_pipeline( tolower_multichar_filter() |
+                                  padding_filter('a') |
+                                  file_sink(dest3.name(), out_mode) )
+        );
+        write_data_in_chunks(out3);
+    }
+
+    BOOST_CHECK_MESSAGE(
+        compare_files(dest1.name(), dest2.name()),
+        "failed writing to a static_pipeline of single-character filters"
+    );
+    BOOST_CHECK_MESSAGE(
+        compare_files(dest1.name(), dest3.name()),
+        "failed writing to a static_pipeline of multi-character filters"
+    );
+}
+
+void close_static_pipeline()
+{
+    // Input sequences are closed in reverse order
+    {
+        operation_sequence seq;
+        static_pipeline<
+            closable_filter<input>,
+            static_pipeline<
+                closable_filter<input>,
+                closable_device<input>
+            >
+        > p( closable_filter<input>(seq.new_operation(3)),
+             static_pipeline<
+                 closable_filter<input>,
+                 closable_device<input>
+             >( closable_filter<input>(seq.new_operation(2)),
+                closable_device<input>(seq.new_operation(1)) ) );
+        BOOST_CHECK_NO_THROW(io::close(p));
+        BOOST_CHECK_OPERATION_SEQUENCE(seq);
+    }
+
+    // Output sequences are closed in forward order
+    {
+        operation_sequence seq;
+        static_pipeline<
+            closable_filter<output>,
+            static_pipeline<
+                closable_filter<output>,
+                closable_device<output>
+            >
+        > p( closable_filter<output>(seq.new_operation(1)),
+             static_pipeline<
+                 closable_filter<output>,
+                 closable_device<output>
+             >( closable_filter<output>(seq.new_operation(2)),
+                closable_device<output>(seq.new_operation(3)) ) );
+        BOOST_CHECK_NO_THROW(io::close(p));
+        BOOST_CHECK_OPERATION_SEQUENCE(seq);
+    }
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("static_pipeline test");
+    test->add(BOOST_TEST_CASE(&read_static_pipeline));
+    test->add(BOOST_TEST_CASE(&write_static_pipeline));
+    test->add(BOOST_TEST_CASE(&close_static_pipeline));
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
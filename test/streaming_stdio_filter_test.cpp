@@ -0,0 +1,229 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <cctype>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filter/streaming_stdio.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/filters.hpp"
+#include "detail/temp_file.hpp"
+#include "detail/verification.hpp"
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+
+// Filters which are given their streams, and so may be chained
+struct toupper_streaming_filter : streaming_stdio_filter {
+    toupper_streaming_filter() : streaming_stdio_filter(100) { }
+    void do_filter(istream& in, ostream& out)
+    {
+        int c;
+        while ((c = in.get()) != EOF)
+            out.put(std::toupper((unsigned char)c));
+    }
+};
+
+struct padding_streaming_filter : streaming_stdio_filter {
+    padding_streaming_filter(char pad_char)
+        : streaming_stdio_filter(64), pad_char_(pad_char)
+        { }
+    void do_filter(istream& in, ostream& out)
+    {
+        int c;
+        while ((c = in.get()) != EOF) {
+            out.put(c);
+            out.put(pad_char_);
+        }
+    }
+    char pad_char_;
+};
+
+// Filters written against std::cin and std::cout
+struct toupper_stdio_filter : streaming_stdio_filter {
+    void do_filter()
+    {
+        int c;
+        while ((c = std::cin.get()) != EOF)
+            std::cout.put(std::toupper((unsigned char)c));
+    }
+};
+
+struct tolower_stdio_filter : streaming_stdio_filter {
+    void do_filter()
+    {
+        int c;
+        while ((c = std::cin.get()) != EOF)
+            std::cout.put(std::tolower((unsigned char)c));
+    }
+};
+
+// Filter which throws after copying a given number of characters
+struct throwing_streaming_filter : streaming_stdio_filter {
+    explicit throwing_streaming_filter(int limit) : limit_(limit) { }
+    void do_filter(istream& in, ostream& out)
+    {
+        int c;
+        for (int z = 0; (c = in.get()) != EOF; ++z) {
+            if (z == limit_)
+                throw std::runtime_error("throwing_streaming_filter");
+            out.put(c);
+        }
+    }
+    int limit_;
+};
+
+// Source which produces an endless sequence of characters
+struct endless_source : source {
+    std::streamsize read(char* s, std::streamsize n)
+    {
+        for (std::streamsize z = 0; z < n; ++z)
+            s[z] = 'a' + z % 26;
+        return n;
+    }
+};
+
+void read_streaming_stdio_filter()
+{
+    test_file          src1, src2;
+    filtering_istream  first, second;
+
+    first.push(toupper_filter());
+    first.push(padding_filter('a'));
+    first.push(file_source(src1.name(), in_mode));
+    second.push(toupper_streaming_filter());
+    second.push(padding_streaming_filter('a'));
+    second.push(file_source(src2.name(), in_mode));
+    BOOST_CHECK_MESSAGE(
+        compare_streams_in_chunks(first, second),
+        "failed reading from a streaming_stdio_filter"
+    );
+
+    first.reset();
+    first.push(toupper_filter());
+    first.push(file_source(src1.name(), in_mode));
+    second.reset();
+    second.push(toupper_stdio_filter());
+    second.push(file_source(src2.name(), in_mode));
+    BOOST_CHECK_MESSAGE(
+        compare_streams_in_chars(first, second),
+        "failed reading from a streaming_stdio_filter using std::cin"
+    );
+}
+
+void write_streaming_stdio_filter()
+{
+    temp_file          dest1, dest2;
+    filtering_ostream  out1, out2;
+
+    out1.push(padding_filter('a'));
+    out1.push(tolower_filter());
+    out1.push(file_sink(dest1.name(), out_mode));
+    out2.push(padding_streaming_filter('a'));
+    out2.push(tolower_stdio_filter());
+    out2.push(file_sink(dest2.name(), out_mode));
+    write_data_in_chunks(out1);
+    write_data_in_chunks(out2);
+    out1.reset();
+    out2.reset();
+
+    {
+        ifstream first(dest1.name().c_str());
+        ifstream second(dest2.name().c_str());
+        BOOST_CHECK_MESSAGE(
+            compare_streams_in_chunks(first, second),
+            "failed writing to a streaming_stdio_filter"
+        );
+    }
+
+    out1.push(tolower_filter());
+    out1.push(file_sink(dest1.name(), out_mode));
+    out2.push(tolower_stdio_filter());
+    out2.push(file_sink(dest2.name(), out_mode));
+    write_data_in_chars(out1);
+    write_data_in_chars(out2);
+    out1.reset();
+    out2.reset();
+
+    {
+        ifstream first(dest1.name().c_str());
+        ifstream second(dest2.name().c_str());
+        BOOST_CHECK_MESSAGE(
+            compare_streams_in_chunks(first, second),
+            "failed writing to a streaming_stdio_filter using std::cin"
+        );
+    }
+}
+
+void unbounded_input_test()
+{
+    // Output is available before the end of the input
+    filtering_istream in;
+    in.push(toupper_streaming_filter());
+    in.push(endless_source());
+    string result;
+    for (int z = 0; z < 100000; ++z)
+        result += static_cast<char>(in.get());
+    BOOST_CHECK_EQUAL(result.size(), 100000u);
+    BOOST_CHECK_EQUAL(result.substr(0, 3), "ABC");
+    BOOST_CHECK_NO_THROW(in.reset());
+}
+
+void error_test()
+{
+    // Characters written before an exception are delivered first
+    {
+        filtering_istream in;
+        in.push(throwing_streaming_filter(1000));
+        in.push(endless_source());
+        in.exceptions(BOOST_IOS::badbit);
+        string result;
+        try {
+            for (int c; (c = in.get()) != EOF; )
+                result += static_cast<char>(c);
+            BOOST_ERROR("failed propagating exception from filter");
+        } catch (const std::exception&) { }
+        BOOST_CHECK_EQUAL(result.size(), 1000u);
+        BOOST_CHECK_NO_THROW(in.reset());
+    }
+
+    // On output, the exception is rethrown by write or close
+    {
+        string dest;
+        filtering_ostream out;
+        out.push(throwing_streaming_filter(1000));
+        out.push(boost::iostreams::back_inserter(dest));
+        string data(5000, 'x');
+        out.exceptions(BOOST_IOS::badbit);
+        BOOST_CHECK_THROW(
+            { out.write(data.data(), 5000); out.pop(); },
+            std::exception
+        );
+        BOOST_CHECK_EQUAL(dest.size(), 1000u);
+    }
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("streaming_stdio_filter test");
+    test->add(BOOST_TEST_CASE(&read_streaming_stdio_filter));
+    test->add(BOOST_TEST_CASE(&write_streaming_stdio_filter));
+    test->add(BOOST_TEST_CASE(&unbounded_input_test));
+    test->add(BOOST_TEST_CASE(&error_test));
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
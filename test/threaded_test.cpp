@@ -0,0 +1,216 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/device/file.hpp>
+#include <boost/iostreams/filtering_stream.hpp>
+#include <boost/iostreams/filtering_streambuf.hpp>
+#include <boost/iostreams/threaded.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+#include "detail/closable.hpp"
+#include "detail/operation_sequence.hpp"
+#include "detail/filters.hpp"
+#include "detail/temp_file.hpp"
+#include "detail/verification.hpp"
+
+// Must come last.
+#include <boost/iostreams/detail/config/disable_warnings.hpp> // BCC 5.x.
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace boost::iostreams::test;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+// Filter which throws once a given number of characters have been written
+struct throwing_filter : public multichar_output_filter {
+    explicit throwing_filter(std::streamsize limit) : limit_(limit) { }
+    template<typename Sink>
+    std::streamsize write(Sink& snk, const char* s, std::streamsize n)
+    {
+        if (n > limit_)
+            throw std::runtime_error("throwing_filter");
+        limit_ -= n;
+        return io::write(snk, s, n);
+    }
+    std::streamsize limit_;
+};
+
+// Filter which accepts nothing from every other call to write(), as a Filter
+// writing to a non-blocking Sink may
+struct stuttering_filter : public multichar_output_filter {
+    stuttering_filter() : block_(false) { }
+    template<typename Sink>
+    std::streamsize write(Sink& snk, const char* s, std::streamsize n)
+    {
+        block_ = !block_;
+        return block_ ? 0 : io::write(snk, s, (std::min)(n, std::streamsize(7)));
+    }
+    bool block_;
+};
+
+// Filter which accepts nothing
+struct blocked_filter : public multichar_output_filter {
+    template<typename Sink>
+    std::streamsize write(Sink&, const char*, std::streamsize) { return 0; }
+};
+
+void write_threaded_test()
+{
+    temp_file dest1, dest2, dest3;
+
+    {
+        filtering_ostream out;
+        out.push(tolower_multichar_filter());
+        out.push(padding_filter('a'));
+        out.push(file_sink(dest1.name(), out_mode));
+        write_data_in_chunks(out);
+    }
+
+    // One worker thread
+    {
+        filtering_ostream out;
+        out.push(threaded(tolower_multichar_filter()));
+        out.push(padding_filter('a'));
+        out.push(file_sink(dest2.name(), out_mode));
+        write_data_in_chunks(out);
+    }
+
+    // Two worker threads, with a ring smaller than the data written
+    {
+        filtering_ostream out;
+        out.push(threaded(tolower_multichar_filter(), 100));
+        out.push(threaded(padding_filter('a'), 100));
+        out.push(file_sink(dest3.name(), out_mode));
+        write_data_in_chunks(out);
+    }
+
+    BOOST_CHECK_MESSAGE(
+        compare_files(dest1.name(), dest2.name()),
+        "failed writing through a threaded_filter"
+    );
+    BOOST_CHECK_MESSAGE(
+        compare_files(dest1.name(), dest3.name()),
+        "failed writing through a chain of threaded_filters"
+    );
+}
+
+void flush_threaded_test()
+{
+    std::string        dest;
+    filtering_ostream  out( threaded(tolower_multichar_filter()) |
+                            threaded(padding_filter('a')) |
+                            io::back_inserter(dest) );
+    for (int z = 0; z < 100; ++z) {
+        out << "AbC";
+        out.flush();
+        BOOST_CHECK_EQUAL(dest.size(), 6u * (z + 1));
+    }
+    out.reset();
+    std::string expected;
+    for (int z = 0; z < 100; ++z)
+        expected += "aabaca";
+    BOOST_CHECK(dest == expected);
+
+    // Reopening after close
+    dest.clear();
+    threaded_filter<tolower_multichar_filter> f =
+        threaded(tolower_multichar_filter());
+    for (int z = 0; z < 3; ++z) {
+        out.push(f);
+        out.push(io::back_inserter(dest));
+        out << "XyZ";
+        out.reset();
+    }
+    BOOST_CHECK(dest == "xyzxyzxyz");
+}
+
+void exception_threaded_test()
+{
+    // An exception thrown on the worker thread is rethrown by flush()
+    {
+        std::string        dest;
+        filtering_ostream  out;
+        out.push(threaded(throwing_filter(10)));
+        out.push(io::back_inserter(dest));
+        out << "0123456789";
+        out.flush();
+        BOOST_CHECK(out.good());
+        out << "x";
+        out.flush();
+        BOOST_CHECK(out.bad());
+        BOOST_CHECK(dest == "0123456789");
+    }
+
+    // ... and by close(), which still closes the filter and the sink
+    {
+        operation_sequence seq;
+        threaded_filter<throwing_filter> f(throwing_filter(0));
+        filtering_ostreambuf ch;
+        ch.push(f);
+        ch.push(closable_device<output>(seq.new_operation(1)));
+        ch.sputn("x", 1);
+        BOOST_CHECK_THROW(ch.reset(), std::exception);
+        BOOST_CHECK_OPERATION_SEQUENCE(seq);
+    }
+
+    // A ring size which is not positive is rejected
+    BOOST_CHECK_THROW(threaded(throwing_filter(0), 0), std::invalid_argument);
+    BOOST_CHECK_THROW(threaded(throwing_filter(0), -1), std::invalid_argument);
+}
+
+void would_block_threaded_test()
+{
+    std::string dest;
+    {
+        filtering_ostream out;
+        out.push(threaded(stuttering_filter(), 16));
+        out.push(io::back_inserter(dest));
+        write_data_in_chunks(out);
+    }
+    std::string expected;
+    for (int z = 0; z < data_reps; ++z)
+        expected.append(narrow_data(), data_length());
+    BOOST_CHECK(dest == expected);
+
+    // Destruction does not wait for a Sink which never accepts characters
+    std::string                      none;
+    back_insert_device<std::string>  snk(none);
+    {
+        threaded_filter<blocked_filter> f(blocked_filter(), 16);
+        BOOST_CHECK_EQUAL(f.write(snk, "abc", 3), 3);
+    }
+    BOOST_CHECK(none.empty());
+}
+
+void close_threaded_test()
+{
+    operation_sequence seq;
+    filtering_ostreambuf ch;
+    ch.push(threaded(closable_filter<output>(seq.new_operation(1))));
+    ch.push(threaded(closable_filter<output>(seq.new_operation(2))));
+    ch.push(closable_device<output>(seq.new_operation(3)));
+    ch.sputn("abc", 3);
+    BOOST_CHECK_NO_THROW(ch.reset());
+    BOOST_CHECK_OPERATION_SEQUENCE(seq);
+}
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("threaded test");
+    test->add(BOOST_TEST_CASE(&write_threaded_test));
+    test->add(BOOST_TEST_CASE(&flush_threaded_test));
+    test->add(BOOST_TEST_CASE(&exception_threaded_test));
+    test->add(BOOST_TEST_CASE(&would_block_threaded_test));
+    test->add(BOOST_TEST_CASE(&close_threaded_test));
+    return test;
+}
+
+#include <boost/iostreams/detail/config/enable_warnings.hpp>
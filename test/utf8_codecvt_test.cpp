@@ -0,0 +1,270 @@
+// (C) Copyright 2026 The Boost.Iostreams Contributors
+// Distributed under the Boost Software License, Version 1.0. (See accompanying
+// file LICENSE_1_0.txt or copy at http://www.boost.org/LICENSE_1_0.txt.)
+
+// See http://www.boost.org/libs/iostreams for documentation.
+
+// Recognize the facets of <codecvt>; see standard_facet_test.
+#define BOOST_IOSTREAMS_STD_UTF8_CODECVT
+
+#include <boost/iostreams/detail/config/wide_streams.hpp>
+#ifdef BOOST_IOSTREAMS_NO_WIDE_STREAMS
+# error wide streams not supported on this platform
+#endif
+
+#include <algorithm>         // min.
+#include <cstddef>           // size_t.
+#include <string>
+#include <vector>
+#include <boost/config.hpp>
+#include <boost/cstdint.hpp>
+#include <boost/iostreams/code_converter.hpp>
+#include <boost/iostreams/device/array.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
+#include <boost/iostreams/utf8_codecvt.hpp>
+#include <boost/test/test_tools.hpp>
+#include <boost/test/unit_test.hpp>
+
+using namespace std;
+using namespace boost::iostreams;
+using boost::unit_test::test_suite;
+namespace io = boost::iostreams;
+
+typedef boost::uint32_t code_point;
+
+// Reference encoders
+
+void append_utf8(string& s, code_point c)
+{
+    if (c < 0x80) {
+        s += static_cast<char>(c);
+    } else if (c < 0x800) {
+        s += static_cast<char>(0xC0 | (c >> 6));
+        s += static_cast<char>(0x80 | (c & 0x3F));
+    } else if (c < 0x10000) {
+        s += static_cast<char>(0xE0 | (c >> 12));
+        s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        s += static_cast<char>(0x80 | (c & 0x3F));
+    } else {
+        s += static_cast<char>(0xF0 | (c >> 18));
+        s += static_cast<char>(0x80 | ((c >> 12) & 0x3F));
+        s += static_cast<char>(0x80 | ((c >> 6) & 0x3F));
+        s += static_cast<char>(0x80 | (c & 0x3F));
+    }
+}
+
+template<typename Ch>
+void append_utf(basic_string<Ch>& s, code_point c, int bits)
+{
+    if (bits == 16 && c >= 0x10000) {
+        c -= 0x10000;
+        s += static_cast<Ch>(0xD800 + (c >> 10));
+        s += static_cast<Ch>(0xDC00 + (c & 0x3FF));
+    } else {
+        s += static_cast<Ch>(c);
+    }
+}
+
+// Returns a sequence of code points with long ASCII runs, mixed with
+// characters of each length and surrogate pairs.
+vector<code_point> test_code_points()
+{
+    vector<code_point> result;
+    code_point         samples[] = { 0xE9, 0x3B1, 0x20AC, 0xFFFD, 0x1F600,
+                                     0x10FFFF, 0x7FF, 0x800, 0xFFFF,
+                                     0x10000 };
+    unsigned int       seed = 1;
+    for (int z = 0; z < 20000; ++z) {
+        seed = seed * 1103515245 + 12345;
+        if ((seed >> 16) % 8 == 0)
+            result.push_back(samples[(seed >> 8) % 10]);
+        else
+            result.push_back('a' + (seed >> 16) % 26);
+    }
+    return result;
+}
+
+// Reads from a code_converter in chunks of varying sizes, starting with
+// single characters.
+template<typename Codecvt>
+basic_string<typename Codecvt::intern_type>
+read_in_chunks(const string& src)
+{
+    typedef typename Codecvt::intern_type      char_type;
+    code_converter<array_source, Codecvt>     in(
+        array_source(src.data(), src.size()), 64
+    );
+    basic_string<char_type>  result;
+    char_type                buf[97];
+    for (std::streamsize n = 1, amt; (amt = in.read(buf, n)) != -1; ) {
+        result.append(buf, static_cast<std::size_t>(amt));
+        n = n % 97 + 1;
+    }
+    in.close();
+    return result;
+}
+
+// Writes to a code_converter in chunks of varying sizes, resending the
+// characters which are not accepted.
+template<typename Codecvt>
+string write_in_chunks(const basic_string<typename Codecvt::intern_type>& src)
+{
+    typedef typename Codecvt::intern_type                  char_type;
+    typedef io::back_insert_device<string>                 sink_type;
+    string                                 result;
+    code_converter<sink_type, Codecvt>     out(io::back_inserter(result), 64);
+    const char_type*  next = src.data();
+    const char_type*  end = src.data() + src.size();
+    for (std::streamsize n = 1; next != end; n = n % 97 + 1) {
+        std::streamsize amt = (std::min)(n, std::streamsize(end - next));
+        next += out.write(next, amt);
+    }
+    out.close();
+    return result;
+}
+
+template<typename Codecvt>
+void round_trip(int bits)
+{
+    typedef typename Codecvt::intern_type char_type;
+    vector<code_point>       points = test_code_points();
+    string                   narrow;
+    basic_string<char_type>  wide;
+    for (size_t z = 0; z < points.size(); ++z) {
+        append_utf8(narrow, points[z]);
+        append_utf(wide, points[z], bits);
+    }
+    BOOST_CHECK(read_in_chunks<Codecvt>(narrow) == wide);
+    BOOST_CHECK(write_in_chunks<Codecvt>(wide) == narrow);
+
+    // Through the facet interface
+    Codecvt             cvt;
+    mbstate_t           state = mbstate_t();
+    vector<char_type>   buf(wide.size());
+    const char*         next1;
+    char_type*          next2;
+    BOOST_CHECK( cvt.in( state, narrow.data(), narrow.data() + narrow.size(),
+                         next1, &buf[0], &buf[0] + buf.size(), next2 )
+                 == codecvt_base::ok );
+    BOOST_CHECK(basic_string<char_type>(&buf[0], next2) == wide);
+    BOOST_CHECK_EQUAL(
+        cvt.length( state, narrow.data(), narrow.data() + narrow.size(),
+                    wide.size() ),
+        static_cast<int>(narrow.size())
+    );
+}
+
+void round_trip_test()
+{
+    round_trip< utf8_codecvt<wchar_t> >(sizeof(wchar_t) == 2 ? 16 : 32);
+#if !defined(BOOST_NO_CXX11_CHAR16_T)
+    round_trip< utf8_codecvt<char16_t> >(16);
+#endif
+#if !defined(BOOST_NO_CXX11_CHAR32_T)
+    round_trip< utf8_codecvt<char32_t> >(32);
+#endif
+}
+
+void length_test()
+{
+    // "a", U+00E9, U+1F600 and "b"
+    utf8_codecvt<wchar_t>  cvt;
+    mbstate_t              state = mbstate_t();
+    string                 src("a\xC3\xA9\xF0\x9F\x98\x80" "b");
+    const char*            first = src.data();
+    const char*            last = src.data() + src.size();
+    BOOST_CHECK_EQUAL(cvt.length(state, first, last, 0), 0);
+    BOOST_CHECK_EQUAL(cvt.length(state, first, last, 1), 1);
+    BOOST_CHECK_EQUAL(cvt.length(state, first, last, 2), 3);
+    if (sizeof(wchar_t) == 2) {
+        BOOST_CHECK_EQUAL(cvt.length(state, first, last, 3), 3);
+        BOOST_CHECK_EQUAL(cvt.length(state, first, last, 4), 7);
+    } else {
+        BOOST_CHECK_EQUAL(cvt.length(state, first, last, 3), 7);
+    }
+    BOOST_CHECK_EQUAL(cvt.length(state, first, last, 100), 8);
+    BOOST_CHECK_EQUAL(cvt.max_length(), 4);
+}
+
+// Returns the result of decoding the given UTF-8 with replacement.
+wstring decode_replacing(const string& src)
+{
+    return read_in_chunks< utf8_codecvt<wchar_t, utf8_replace> >(src);
+}
+
+bool decode_throws(const string& src)
+{
+    try {
+        read_in_chunks< utf8_codecvt<wchar_t> >(src);
+    } catch (const code_conversion_error&) {
+        return true;
+    }
+    return false;
+}
+
+void invalid_input_test()
+{
+    const wchar_t r = 0xFFFD;
+    const char* invalid[] = {
+        "\x80", "\xC0\xAF", "\xE0\x80\x80", "\xED\xA0\x80", "\xF4\x90\x80\x80",
+        "\xF8\x88\x80\x80\x80", "a\xC3(b", "\xF0\x9F\x98"
+    };
+    for (size_t z = 0; z < sizeof(invalid) / sizeof(invalid[0]); ++z)
+        BOOST_CHECK_MESSAGE(decode_throws(invalid[z]), "case " << z);
+
+    // One U+FFFD per maximal subpart
+    BOOST_CHECK(decode_replacing("\x80") == wstring(1, r));
+    BOOST_CHECK(decode_replacing("\xC0\xAF") == wstring(2, r));
+    BOOST_CHECK(decode_replacing("\xE0\x80\x80") == wstring(3, r));
+    BOOST_CHECK(decode_replacing("\xED\xA0\x80") == wstring(3, r));
+    BOOST_CHECK(decode_replacing("\xF4\x90\x80\x80") == wstring(4, r));
+    BOOST_CHECK(decode_replacing("\xE2\x82(") == wstring(1, r) + L"(");
+    BOOST_CHECK(decode_replacing("a\xC3(b") == L"a" + wstring(1, r) + L"(b");
+
+    // A character truncated by the end of the stream
+    BOOST_CHECK(decode_replacing("ab\xF0\x9F\x98") == L"ab" + wstring(1, r));
+
+    // Output of unpaired surrogates
+    typedef utf8_codecvt<wchar_t, utf8_replace> replacing_codecvt;
+    wstring lone(1, static_cast<wchar_t>(0xDC00));
+    BOOST_CHECK_THROW(
+        write_in_chunks< utf8_codecvt<wchar_t> >(lone),
+        code_conversion_error
+    );
+    BOOST_CHECK(
+        write_in_chunks<replacing_codecvt>(L"a" + lone) == "a\xEF\xBF\xBD"
+    );
+}
+
+#if !defined(BOOST_NO_CXX11_HDR_CODECVT) && !defined(BOOST_NO_CXX11_CHAR16_T)
+
+void standard_facet_test()
+{
+    typedef std::codecvt_utf8_utf16<char16_t> codecvt_type;
+    BOOST_STATIC_ASSERT(detail::utf8_conversion<codecvt_type>::bits == 16);
+    vector<code_point>  points = test_code_points();
+    string              narrow;
+    u16string           wide;
+    for (size_t z = 0; z < points.size(); ++z) {
+        append_utf8(narrow, points[z]);
+        append_utf(wide, points[z], 16);
+    }
+    BOOST_CHECK(read_in_chunks<codecvt_type>(narrow) == wide);
+    BOOST_CHECK(write_in_chunks<codecvt_type>(wide) == narrow);
+}
+
+#else
+
+void standard_facet_test() { }
+
+#endif
+
+test_suite* init_unit_test_suite(int, char* [])
+{
+    test_suite* test = BOOST_TEST_SUITE("utf8_codecvt test");
+    test->add(BOOST_TEST_CASE(&round_trip_test));
+    test->add(BOOST_TEST_CASE(&length_test));
+    test->add(BOOST_TEST_CASE(&invalid_input_test));
+    test->add(BOOST_TEST_CASE(&standard_facet_test));
+    return test;
+}
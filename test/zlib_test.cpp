@@ -6,6 +6,9 @@
 // See http://www.boost.org/libs/iostreams for documentation.
 
 #include <string>
+#include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/detail/adaptive_level.hpp>
+#include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filter/test.hpp>
 #include <boost/iostreams/filter/zlib.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
@@ -73,9 +76,152 @@ void zlib_test()
     }
 }
 
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+
+// Clock installed with adaptive_level::set_clock, which advances only when
+// clocked_sink is written to, so that the compressor appears to spend no
+// time compressing.
+boost::intmax_t fake_now = 0;
+boost::intmax_t fake_clock() { return fake_now; }
+
+// Sink which advances fake_now by the given number of nanoseconds on each
+// write.
+struct clocked_sink : boost::iostreams::sink {
+    clocked_sink(std::string& str, const boost::intmax_t& delay)
+        : str_(&str), delay_(&delay)
+        { }
+    std::streamsize write(const char* s, std::streamsize n)
+    {
+        fake_now += *delay_;
+        str_->append(s, static_cast<std::size_t>(n));
+        return n;
+    }
+    std::string*            str_;
+    const boost::intmax_t*  delay_;
+};
+
+void adaptive_test()
+{
+    // Poorly compressible input, so that the output buffer fills often.
+    std::string    input;
+    unsigned long  seed = 1;
+    for (int z = 0; z < 256 * 1024; ++z) {
+        seed = seed * 1103515245 + 12345;
+        input += static_cast<char>('a' + (seed >> 16) % 16);
+    }
+
+    zlib_params p(zlib::best_speed);
+    p.adaptive = true;
+    p.min_level = 2;
+    p.max_level = 7;
+    p.adaptive_block_size = 16384;
+    BOOST_CHECK(
+        test_filter_pair( zlib_compressor(p), zlib_decompressor(),
+                          input.substr(0, 32768) )
+    );
+
+    // The initial level is clamped to the bounds.
+    zlib_compressor compressor(p);
+    BOOST_CHECK_EQUAL(compressor.level(), 2);
+
+    // While the sink takes no time, the level is kept; once it becomes
+    // the bottleneck, the level rises partway through the stream.
+    iostreams::detail::adaptive_level::set_clock(&fake_clock);
+    std::string        compressed, decompressed;
+    boost::intmax_t    delay = 0;
+    std::streamsize    half = static_cast<std::streamsize>(input.size() / 2);
+    filtering_ostream  out;
+    out.push(compressor);
+    out.push(clocked_sink(compressed, delay));
+    out.write(input.data(), half);
+    BOOST_CHECK_EQUAL(compressor.level(), 2);
+    delay = 1000000;
+    out.write(input.data() + half, half);
+    out.reset();
+    iostreams::detail::adaptive_level::set_clock(0);
+    BOOST_CHECK(compressor.level() > 2);
+
+    boost::iostreams::copy(
+        boost::iostreams::array_source(compressed.data(), compressed.size()),
+        boost::iostreams::compose(
+            zlib_decompressor(),
+            boost::iostreams::back_inserter(decompressed)
+        )
+    );
+    BOOST_CHECK(input == decompressed);
+}
+
+// Runs one call to a compressor's filter function which takes filter
+// nanoseconds and consumes the given number of characters, after which the
+// output buffer takes sink nanoseconds to be written.
+void filter_step( iostreams::detail::adaptive_level& a, boost::intmax_t& now,
+                  boost::intmax_t filter, boost::intmax_t sink,
+                  std::streamsize consumed )
+{
+    a.begin(now);
+    now += filter;
+    a.end(consumed, true, now);
+    now += sink;
+}
+
+void adaptive_level_test()
+{
+    iostreams::detail::adaptive_level  a;
+    boost::intmax_t                    now = 0;
+
+    // The initial level is clamped to the bounds
+    a.open(true, 9, 2, 7, 100);
+    BOOST_CHECK(a.enabled());
+    BOOST_CHECK_EQUAL(a.level(), 7);
+
+    // A slow sink raises the level once per block
+    a.open(true, 4, 2, 7, 100);
+    filter_step(a, now, 10, 100, 50);
+    BOOST_CHECK(!a.pending());
+    filter_step(a, now, 10, 100, 50);
+    BOOST_CHECK(a.pending());
+    BOOST_CHECK_EQUAL(a.target(), 5);
+    BOOST_CHECK_EQUAL(a.level(), 4);
+
+    // No new level is proposed until the last is applied
+    filter_step(a, now, 10, 100, 100);
+    BOOST_CHECK_EQUAL(a.target(), 5);
+    a.commit();
+    BOOST_CHECK_EQUAL(a.level(), 5);
+    BOOST_CHECK(!a.pending());
+
+    // Balanced timings keep the level
+    a.close();
+    filter_step(a, now, 50, 50, 50);
+    filter_step(a, now, 50, 50, 50);
+    BOOST_CHECK(!a.pending());
+
+    // Slow compression lowers the level, but not below the minimum
+    a.open(true, 3, 2, 7, 100);
+    filter_step(a, now, 100, 10, 100);
+    BOOST_CHECK_EQUAL(a.target(), 2);
+    a.commit();
+    filter_step(a, now, 100, 10, 100);
+    BOOST_CHECK(!a.pending());
+    BOOST_CHECK_EQUAL(a.level(), 2);
+
+    // Without adaptation, the level never changes
+    a.open(false, 9, 2, 7, 100);
+    BOOST_CHECK(!a.enabled());
+    filter_step(a, now, 10, 100, 100);
+    BOOST_CHECK(!a.pending());
+    BOOST_CHECK_EQUAL(a.level(), 9);
+}
+
+#endif // #ifndef BOOST_NO_CXX11_HDR_CHRONO
+
 test_suite* init_unit_test_suite(int, char* []) 
 {
     test_suite* test = BOOST_TEST_SUITE("zlib test");
     test->add(BOOST_TEST_CASE(&zlib_test));
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+    test->add(BOOST_TEST_CASE(&adaptive_test));
+    test->add(BOOST_TEST_CASE(&adaptive_level_test));
+#endif
     return test;
 }
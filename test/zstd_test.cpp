@@ -13,6 +13,7 @@
 #include <cstddef>
 #include <string>
 #include <boost/iostreams/copy.hpp>
+#include <boost/iostreams/detail/adaptive_level.hpp>
 #include <boost/iostreams/device/array.hpp>
 #include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/filter/zstd.hpp>
@@ -182,6 +183,82 @@ void multipart_test()
     BOOST_CHECK(!in.bad());
 }
 
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+
+// Clock installed with adaptive_level::set_clock, which advances only when
+// clocked_sink is written to, so that the compressor appears to spend no
+// time compressing.
+boost::intmax_t fake_now = 0;
+boost::intmax_t fake_clock() { return fake_now; }
+
+// Sink which advances fake_now by the given number of nanoseconds on each
+// write.
+struct clocked_sink : io::sink {
+    clocked_sink(std::string& str, const boost::intmax_t& delay)
+        : str_(&str), delay_(&delay)
+        { }
+    std::streamsize write(const char* s, std::streamsize n)
+    {
+        fake_now += *delay_;
+        str_->append(s, static_cast<std::size_t>(n));
+        return n;
+    }
+    std::string*            str_;
+    const boost::intmax_t*  delay_;
+};
+
+void adaptive_test()
+{
+    // Poorly compressible input, so that the output buffer fills often;
+    // zstd emits its output a block of up to 128KB at a time, so several
+    // blocks are needed on each side of the change of sink speed.
+    std::string    input;
+    unsigned long  seed = 1;
+    for (int z = 0; z < 1024 * 1024; ++z) {
+        seed = seed * 1103515245 + 12345;
+        input += static_cast<char>('a' + (seed >> 16) % 16);
+    }
+
+    zstd_params p(zstd::best_speed);
+    p.adaptive = true;
+    p.min_level = 2;
+    p.max_level = 7;
+    p.adaptive_block_size = 16384;
+    BOOST_CHECK(
+        test_filter_pair( zstd_compressor(p), zstd_decompressor(),
+                          input.substr(0, 32768) )
+    );
+
+    // The initial level is clamped to the bounds.
+    zstd_compressor compressor(p);
+    BOOST_CHECK_EQUAL(compressor.level(), 2u);
+
+    // While the sink takes no time, the level is kept; once it becomes
+    // the bottleneck, the level rises partway through the stream, and
+    // each change of level starts a new frame.
+    iostreams::detail::adaptive_level::set_clock(&fake_clock);
+    std::string        compressed, decompressed;
+    boost::intmax_t    delay = 0;
+    std::streamsize    half = static_cast<std::streamsize>(input.size() / 2);
+    filtering_ostream  out;
+    out.push(compressor);
+    out.push(clocked_sink(compressed, delay));
+    out.write(input.data(), half);
+    BOOST_CHECK_EQUAL(compressor.level(), 2u);
+    delay = 1000000;
+    out.write(input.data() + half, half);
+    out.reset();
+    iostreams::detail::adaptive_level::set_clock(0);
+    BOOST_CHECK(compressor.level() > 2);
+
+    io::copy(
+        array_source(compressed.data(), compressed.size()),
+        io::compose(zstd_decompressor(), io::back_inserter(decompressed)));
+    BOOST_CHECK(input == decompressed);
+}
+
+#endif // #ifndef BOOST_NO_CXX11_HDR_CHRONO
+
 test_suite* init_unit_test_suite(int, char* [])
 {
     test_suite* test = BOOST_TEST_SUITE("zstd test");
@@ -190,5 +267,8 @@ test_suite* init_unit_test_suite(int, char* [])
     test->add(BOOST_TEST_CASE(&array_source_test));
     test->add(BOOST_TEST_CASE(&empty_file_test));
     test->add(BOOST_TEST_CASE(&multipart_test));
+#ifndef BOOST_NO_CXX11_HDR_CHRONO
+    test->add(BOOST_TEST_CASE(&adaptive_test));
+#endif
     return test;
 }